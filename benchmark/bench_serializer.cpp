@@ -0,0 +1,233 @@
+/**
+ * @file bench_serializer.cpp
+ * @author Bryce Ferenczi
+ * @brief Google-benchmark suite over the serializer hot paths: serialize/deserialize, unit flattening and recovery,
+ * vectorization, bool image unpacking, minimap feature assembly and database random reads. Run per-commit to catch
+ * performance regressions before they show up as slow training epochs.
+ * @version 0.1
+ * @date 2024-05-28
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "data_structures/replay_all.hpp"
+#include "database.hpp"
+#include "instance_transform.hpp"
+#include "replay_parsing.hpp"
+#include "vectorize.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <filesystem>
+#include <numeric>
+#include <random>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::size_t gSteps = 256;
+constexpr std::size_t gUnitsPerStep = 64;
+constexpr std::size_t gNeutralPerStep = 16;
+constexpr int gMapSize = 128;
+
+/**
+ * @brief Synthetic replay with representative step/unit/minimap volume. Values are pseudo-random so compression and
+ * delta-coding see realistic entropy rather than degenerate all-zero buffers.
+ */
+auto createReplay(unsigned seed) -> cvt::ReplayDataSoA
+{
+    std::minstd_rand gen(seed);
+    cvt::ReplayData replay;
+
+    replay.data.resize(gSteps);
+    for (std::size_t step = 0; step < gSteps; ++step) {
+        auto &stepData = replay.data[step];
+        stepData.gameStep = static_cast<std::uint32_t>(step * 2);
+        stepData.minearals = static_cast<std::uint16_t>(gen() % 2000);
+        stepData.vespene = static_cast<std::uint16_t>(gen() % 2000);
+        stepData.popMax = 200;
+        stepData.popArmy = static_cast<std::uint16_t>(gen() % 100);
+        stepData.popWorkers = static_cast<std::uint16_t>(gen() % 80);
+
+        for (std::size_t idx = 0; idx < gUnitsPerStep; ++idx) {
+            cvt::Unit unit{};
+            // Stable ids across steps so flattening groups long per-unit runs like a real replay
+            unit.id = static_cast<cvt::UID>(idx + 1);
+            unit.unitType = static_cast<int>(gen() % 150);
+            unit.health = static_cast<float>(gen() % 200);
+            unit.shield = static_cast<float>(gen() % 100);
+            unit.energy = static_cast<float>(gen() % 50);
+            unit.pos = { static_cast<float>(gen() % gMapSize), static_cast<float>(gen() % gMapSize), 1.f };
+            stepData.units.emplace_back(std::move(unit));
+        }
+        for (std::size_t idx = 0; idx < gNeutralPerStep; ++idx) {
+            cvt::NeutralUnit unit{};
+            unit.id = static_cast<cvt::UID>(1000 + idx);
+            unit.unitType = static_cast<int>(gen() % 20);
+            unit.health = static_cast<float>(gen() % 500);
+            unit.contents = static_cast<std::uint16_t>(gen() % 1500);
+            unit.pos = { static_cast<float>(gen() % gMapSize), static_cast<float>(gen() % gMapSize), 1.f };
+            stepData.neutralUnits.emplace_back(std::move(unit));
+        }
+
+        cvt::Action action = { .unit_ids = { 1, 2, 3 },
+            .ability_id = static_cast<int>(gen() % 300),
+            .target_type = cvt::Action::TargetType::Position,
+            .target = cvt::Action::Target(cvt::Point2d(static_cast<int>(gen() % gMapSize), 2)) };
+        stepData.actions.emplace_back(std::move(action));
+
+        auto fillImage = [&gen](auto &image) {
+            image.resize(gMapSize, gMapSize);
+            std::ranges::generate(image._data, [&gen]() { return static_cast<std::byte>(gen() % 256); });
+        };
+        fillImage(stepData.visibility);
+        fillImage(stepData.creep);
+        fillImage(stepData.player_relative);
+        fillImage(stepData.alerts);
+        fillImage(stepData.buildable);
+        fillImage(stepData.pathable);
+    }
+
+    cvt::Image<std::uint8_t> heightMap;
+    heightMap.resize(gMapSize, gMapSize);
+    std::iota(heightMap.data(), heightMap.data() + heightMap.nelem(), 1);
+    replay.header.heightMap = std::move(heightMap);
+    replay.header.replayHash = "BenchmarkReplayHash";
+    replay.header.durationSteps = static_cast<std::uint32_t>(gSteps);
+    return cvt::AoStoSoA<cvt::ReplayDataSoA, cvt::ReplayData>(replay);
+}
+
+void BM_Serialize(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    std::vector<char> buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        boost::iostreams::filtering_ostream stream;
+        stream.push(boost::iostreams::back_inserter(buffer));
+        cvt::serialize(replay, stream);
+        stream.reset();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_Serialize);
+
+void BM_Deserialize(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    std::vector<char> buffer;
+    {
+        boost::iostreams::filtering_ostream stream;
+        stream.push(boost::iostreams::back_inserter(buffer));
+        cvt::serialize(replay, stream);
+        stream.reset();
+    }
+    for (auto _ : state) {
+        boost::iostreams::filtering_istream stream;
+        stream.push(boost::iostreams::array_source(buffer.data(), buffer.size()));
+        cvt::ReplayDataSoA decoded;
+        cvt::deserialize(decoded, stream);
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_Deserialize);
+
+void BM_FlattenAndSortUnits(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    const auto unitKey = [](const cvt::Unit &unit) { return unit.id; };
+    for (auto _ : state) {
+        auto flattened = cvt::flattenAndSortDataPar<cvt::UnitSoA>(replay.data.units, unitKey);
+        benchmark::DoNotOptimize(flattened);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * gSteps * gUnitsPerStep));
+}
+BENCHMARK(BM_FlattenAndSortUnits);
+
+void BM_RecoverFlattenedUnits(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    const auto flattened =
+        cvt::flattenAndSortDataPar<cvt::UnitSoA>(replay.data.units, [](const cvt::Unit &unit) { return unit.id; });
+    for (auto _ : state) {
+        auto recovered = cvt::recoverFlattenedSortedData2(flattened);
+        benchmark::DoNotOptimize(recovered);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * gSteps * gUnitsPerStep));
+}
+BENCHMARK(BM_RecoverFlattenedUnits);
+
+void BM_VectorizeUnit(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    const auto &units = replay.data.units.front();
+    std::vector<float> outData(cvt::getVectorizedSize<cvt::Unit>(true));
+    for (auto _ : state) {
+        for (const auto &unit : units) {
+            cvt::vectorize(unit, outData.begin(), true);
+            benchmark::DoNotOptimize(outData.data());
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * units.size()));
+}
+BENCHMARK(BM_VectorizeUnit);
+
+void BM_UnpackBoolImage(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    const auto &image = replay.data.creep.front();
+    for (auto _ : state) {
+        auto unpacked = cvt::unpackBoolImage<std::uint8_t>(image);
+        benchmark::DoNotOptimize(unpacked.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * image.nelem()));
+}
+BENCHMARK(BM_UnpackBoolImage);
+
+void BM_MinimapFeatures(benchmark::State &state)
+{
+    const auto replay = createReplay(42);
+    const cvt::MinimapFeatureFlags includedLayers{};
+    const std::size_t nChannels = includedLayers.flags.count() + 3;// player_relative expands to four one-hot layers
+    std::vector<float> outData(nChannels * static_cast<std::size_t>(gMapSize) * static_cast<std::size_t>(gMapSize));
+    std::size_t timeIdx = 0;
+    for (auto _ : state) {
+        cvt::writeMinimapFeatures(replay, timeIdx, includedLayers, true, std::span<float>(outData));
+        timeIdx = (timeIdx + 1) % gSteps;
+        benchmark::DoNotOptimize(outData.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+BENCHMARK(BM_MinimapFeatures);
+
+void BM_DatabaseRandomRead(benchmark::State &state)
+{
+    const fs::path dbPath = "benchdb.sc2db";
+    if (fs::exists(dbPath)) { fs::remove(dbPath); }
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> writeDb(dbPath);
+        for (unsigned seed = 0; seed < 8; ++seed) { writeDb.addEntry(createReplay(seed)); }
+    }
+    cvt::ReplayDatabase<cvt::ReplayDataSoA> replayDb(dbPath);
+
+    std::minstd_rand gen(42);
+    for (auto _ : state) {
+        auto entry = replayDb.getEntry(gen() % replayDb.size());
+        benchmark::DoNotOptimize(entry);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+
+    fs::remove(dbPath);
+    fs::remove(replayDb.uidCachePath());
+    fs::remove(replayDb.headerCachePath());
+}
+BENCHMARK(BM_DatabaseRandomRead);
+
+}// namespace
@@ -17,14 +17,110 @@
 #include "data_structures/replay_minimaps.hpp"
 #include "database.hpp"
 
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <ranges>
+#include <thread>
 
 namespace fs = std::filesystem;
 
 using SrcFormat = cvt::ReplayDataSoA;
 using DstFormat = cvt::ReplayDataSoANoUnits;
 
+/**
+ * @brief Convert a decoded source entry to the destination format.
+ * @param oldReplayData decoded source entry
+ * @return Entry in the destination format
+ */
+[[nodiscard]] auto convertEntry(const SrcFormat &oldReplayData) noexcept -> DstFormat
+{
+    DstFormat newReplayData;
+    newReplayData.header = oldReplayData.header;
+
+    auto &newStepData = newReplayData.data;
+    const auto &oldStepData = oldReplayData.data;
+    newStepData.gameStep = oldStepData.gameStep;
+    newStepData.minearals = oldStepData.minearals;
+    newStepData.vespene = oldStepData.vespene;
+    newStepData.popMax = oldStepData.popMax;
+    newStepData.popArmy = oldStepData.popArmy;
+    newStepData.popWorkers = oldStepData.popWorkers;
+    newStepData.score = oldStepData.score;
+    newStepData.visibility = oldStepData.visibility;
+    newStepData.creep = oldStepData.creep;
+    newStepData.player_relative = oldStepData.player_relative;
+    newStepData.alerts = oldStepData.alerts;
+    newStepData.buildable = oldStepData.buildable;
+    newStepData.pathable = oldStepData.pathable;
+    return newReplayData;
+}
+
+/**
+ * @brief Transcode the not-yet-converted source entries into the destination database with a worker pool. Each worker
+ * claims entries in order and does all the heavy lifting — read+decompress, convert, and serialize+recompress to the
+ * raw tagged entry bytes via makeEntryRaw — and hands the bytes to the main thread, which is a pure ordered append
+ * loop committing entries in source order so an interrupted run resumes cleanly from the last committed entry
+ * (already-converted UIDs are skipped on startup). In-flight compressed entries are bounded by maxInFlight plus one
+ * per worker so memory stays flat on replay-dense shards.
+ * @param source source database to convert from
+ * @param dest destination database to append converted entries to
+ * @param workList source indices remaining to convert, in write order
+ * @param nWorkers number of conversion workers
+ * @param maxInFlight maximum compressed entries buffered ahead of the writer
+ */
+void transcodeParallel(const cvt::ReplayDatabase<SrcFormat> &source,
+    cvt::ReplayDatabase<DstFormat> &dest,
+    const std::vector<std::size_t> &workList,
+    std::size_t nWorkers,
+    std::size_t maxInFlight)
+{
+    std::atomic<std::size_t> nextItem{ 0 };
+    std::map<std::size_t, std::vector<char>> completed;
+    std::size_t nextToWrite = 0;
+    std::mutex mutex;
+    std::condition_variable condVar;
+
+    std::vector<std::jthread> workers;
+    workers.reserve(nWorkers);
+    for (std::size_t w = 0; w < nWorkers; ++w) {
+        workers.emplace_back([&]() {
+            for (std::size_t item = nextItem++; item < workList.size(); item = nextItem++) {
+                // Empty bytes mark a skipped entry, makeEntryRaw has already logged encode failures
+                std::vector<char> rawEntry;
+                try {
+                    rawEntry = dest.makeEntryRaw(convertEntry(source.getEntry(workList[item])));
+                } catch (const std::exception &err) {
+                    SPDLOG_ERROR("Skipping index {}, due to read failure: {}", workList[item], err.what());
+                }
+                std::unique_lock lock(mutex);
+                condVar.wait(lock, [&]() { return item < nextToWrite + maxInFlight; });
+                completed.emplace(item, std::move(rawEntry));
+                condVar.notify_all();
+            }
+        });
+    }
+
+    const auto print_modulo = std::max<std::size_t>(workList.size() / 10, 1);
+    while (nextToWrite < workList.size()) {
+        std::vector<char> rawEntry;
+        {
+            std::unique_lock lock(mutex);
+            condVar.wait(lock, [&]() { return completed.contains(nextToWrite); });
+            rawEntry = std::move(completed.at(nextToWrite));
+            completed.erase(nextToWrite);
+            ++nextToWrite;
+        }
+        condVar.notify_all();
+        if (!rawEntry.empty()) { dest.addEntryRaw(rawEntry); }
+        if (nextToWrite % print_modulo == 0) {
+            fmt::print("Converted {} of {} Replays\n", nextToWrite, workList.size());
+        }
+    }
+}
+
 /**
  * @brief Reads hash,steps pair from text file.
  * @note This was previously required when the number of steps wasn't recorded in the original SC2Replay format. Number
@@ -63,6 +159,10 @@ int main(int argc, char *argv[])
         ("o,output", "Destination database, if folder then use source filename", cxxopts::value<std::string>())
         // ("steps-file", "Contains hash-gamestep pairs", cxxopts::value<std::string>())
         ("offset", "Offset to apply to partition index", cxxopts::value<int>())
+        ("workers", "Number of conversion workers", cxxopts::value<std::size_t>()->default_value("0"))
+        ("in-flight", "Maximum converted entries buffered ahead of the writer, 0 for 2x workers", cxxopts::value<std::size_t>()->default_value("0"))
+        ("batch-size", "Entries per destination commit, larger batches write faster but replay more on resume", cxxopts::value<std::size_t>()->default_value("8"))
+        ("codec", "Compression codec for the destination database [zlib|zstd|none]", cxxopts::value<std::string>()->default_value("zlib"))
         ("h,help", "This help");
     // clang-format on
     const auto cliOpts = cliParser.parse(argc, argv);
@@ -106,45 +206,48 @@ int main(int argc, char *argv[])
     }
     cvt::ReplayDatabase<DstFormat> dest(destPath);
 
+    const auto codecName = cliOpts["codec"].as<std::string>();
+    if (codecName == "zlib") {
+        dest.setWriteCodec(cvt::Codec::Zlib);
+    } else if (codecName == "zstd") {
+        dest.setWriteCodec(cvt::Codec::Zstd);
+    } else if (codecName == "none") {
+        dest.setWriteCodec(cvt::Codec::None);
+    } else {
+        fmt::print("ERROR: Unknown codec: {}\n", codecName);
+        return -1;
+    }
+    dest.setBatchSize(cliOpts["batch-size"].as<std::size_t>());
+
     // const fs::path hashStepFile = cliOpts["steps-file"].as<std::string>();
     // if (!fs::exists(hashStepFile)) { fmt::print("ERROR: Hash-Step file doesn't exist: {}\n", hashStepFile.string());
     // } const auto hash_steps = read_hash_steps_file(hashStepFile);
 
+    // Entries already committed to the destination are skipped, which both resumes an interrupted transcode and
+    // filters potential duplicates from the original dataset
     auto already_converted = dest.getAllUIDs();
-    const auto print_modulo = source.size() / 10;
+    std::vector<std::size_t> workList;
+    workList.reserve(source.size());
     for (std::size_t idx = 0; idx < source.size(); ++idx) {
-        SrcFormat oldReplayData;
-        try {
-            if (already_converted.contains(source.getEntryUID(idx))) { continue; }
-            oldReplayData = source.getEntry(idx);
-        } catch (const std::bad_alloc &err) {
-            SPDLOG_ERROR("Skipping index {}, due to read failure", idx);
-            continue;
+        const auto uid = source.getEntryUID(idx);
+        if (!already_converted.contains(uid)) {
+            workList.push_back(idx);
+            already_converted.insert(uid);
         }
-        DstFormat newReplayData;
-        newReplayData.header = oldReplayData.header;
-
-        auto &newStepData = newReplayData.data;
-        const auto &oldStepData = oldReplayData.data;
-        newStepData.gameStep = oldStepData.gameStep;
-        newStepData.minearals = oldStepData.minearals;
-        newStepData.vespene = oldStepData.vespene;
-        newStepData.popMax = oldStepData.popMax;
-        newStepData.popArmy = oldStepData.popArmy;
-        newStepData.popWorkers = oldStepData.popWorkers;
-        newStepData.score = oldStepData.score;
-        newStepData.visibility = oldStepData.visibility;
-        newStepData.creep = oldStepData.creep;
-        newStepData.player_relative = oldStepData.player_relative;
-        newStepData.alerts = oldStepData.alerts;
-        newStepData.buildable = oldStepData.buildable;
-        newStepData.pathable = oldStepData.pathable;
-
-        dest.addEntry(newReplayData);
-        if (idx % print_modulo == 0) { fmt::print("Converted {} of {} Replays\n", idx + 1, source.size()); }
-        // Add into already_converted to filter out potential duplicates from the original dataset
-        already_converted.insert(newReplayData.header.replayHash + std::to_string(newReplayData.header.playerId));
     }
+    fmt::print("Converting {} of {} Replays ({} already done)\n",
+        workList.size(),
+        source.size(),
+        source.size() - workList.size());
+
+    auto nWorkers = cliOpts["workers"].as<std::size_t>();
+    if (nWorkers == 0) { nWorkers = std::max(1u, std::thread::hardware_concurrency()); }
+    nWorkers = std::min(nWorkers, std::max<std::size_t>(workList.size(), 1));
+    auto maxInFlight = cliOpts["in-flight"].as<std::size_t>();
+    if (maxInFlight == 0) { maxInFlight = 2 * nWorkers; }
+
+    transcodeParallel(source, dest, workList, nWorkers, maxInFlight);
+    if (!dest.flush()) { SPDLOG_ERROR("Failed to flush pending entries to {}", destPath.string()); }
     fmt::print("DONE - Converted {} of {} Replays\n", dest.size(), source.size());
 
     return 0;
@@ -3,16 +3,21 @@
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <ranges>
+#include <thread>
 
 // Observer must be included before Windows.h since it #define's max/min which fucks with std::ranges::{min|max}
 #include "data_structures/replay_all.hpp"
 #include "observer.hpp"
+#include "perf_stats.hpp"
 
 #if defined(_WIN32)
 #include <WinSock2.h>
@@ -220,24 +225,33 @@ auto getDataVersion(
 #endif
 
 /**
- * @brief Run over a vector of replay hashes that are contained in a replay folder and convert them.
- * @tparam T Underlying replay data type of conversion engine
- * @param replayFolder folder that contains the .SC2Replays listed in replayHashes
- * @param replayHashes vector of replay hashes to convert, this should only be the stem of the file path (no extension)
- * @param gamePath path to the "Versions" folder of the game directory
- * @param converter pointer to conversion engine instance, must be initialized outside and not be null
+ * @brief Pull replays from the shared queue and convert them with this worker's own SC2 instance. Replays are
+ * claimed one at a time so short and long replays balance across workers automatically.
+ * @tparam T replay data structure type
+ * @param workerIdx index of this worker, used to offset the SC2 API port
+ * @param replayFolder folder which contains the replay files
+ * @param replayHashes queue of all replay file hashes to convert
+ * @param gamePath path to sc2 game version folders
+ * @param converter replay converter instance owned by this worker
  * @param badFile optional file to log bad replays encountered
  * @param perfPath optional file to log time taken to convert a replay
- * @param port port to run the game api server at
+ * @param port base port to run the game api servers at
+ * @param nextReplay shared index of the next unclaimed replay
+ * @param nComplete shared count of completed replays for progress reporting
+ * @param logMutex guards appends to the bad replay and perf log files
  */
 template<typename T>
-void loopReplayFiles(const fs::path &replayFolder,
+void convertReplayWorker(std::size_t workerIdx,
+    const fs::path &replayFolder,
     const std::vector<std::string> &replayHashes,
     const std::string &gamePath,
     cvt::BaseConverter<T> *converter,
     std::optional<fs::path> badFile,
     std::optional<fs::path> perfPath,
-    int port)
+    int port,
+    std::atomic<std::size_t> &nextReplay,
+    std::atomic<std::size_t> &nComplete,
+    std::mutex &logMutex)
 {
     auto make_coordinator = [&]() {
         auto coordinator = std::make_unique<sc2::Coordinator>();
@@ -251,7 +265,8 @@ void loopReplayFiles(const fs::path &replayFolder,
         coordinator->AddReplayObserver(converter);
         coordinator->SetProcessPath(gamePath);
         coordinator->SetTimeoutMS(30'000);
-        const auto newport = find_available_port(port);
+        // Each worker gets its own port range so concurrent SC2 instances don't collide
+        const auto newport = find_available_port(port + static_cast<int>(workerIdx) * 4);
         if (newport.has_value()) { coordinator->SetPortStart(*newport); }
         return coordinator;
     };
@@ -259,8 +274,8 @@ void loopReplayFiles(const fs::path &replayFolder,
 
     std::string currVer = "";
 
-    std::size_t nComplete = 0;
-    for (auto &&replayHash : replayHashes) {
+    for (std::size_t replayIdx = nextReplay++; replayIdx < replayHashes.size(); replayIdx = nextReplay++) {
+        const auto &replayHash = replayHashes[replayIdx];
         const auto replayPath = (replayFolder / replayHash).replace_extension(".SC2Replay");
         if (!fs::exists(replayPath)) {
             SPDLOG_ERROR("Replay file doesn't exist {}", replayPath.string());
@@ -308,6 +323,7 @@ void loopReplayFiles(const fs::path &replayFolder,
                 while (coordinator->Update()) {}
                 auto durationSec = std::chrono::duration_cast<std::chrono::duration<float>>(clk::now() - startTime);
                 if (perfPath.has_value()) {
+                    std::scoped_lock lock(logMutex);
                     std::ofstream perfFile(perfPath.value(), std::ios::app);
                     perfFile << fmt::format("{},p{},{}\n", replayPath.string(), playerId, durationSec.count());
                 }
@@ -328,6 +344,7 @@ void loopReplayFiles(const fs::path &replayFolder,
                 SPDLOG_ERROR("Finished Game Without Writing, Must Contain An Error, Skipping");
                 if (badFile.has_value()) {
                     SPDLOG_INFO("Adding bad replay to file: {}", replayHash);
+                    std::scoped_lock lock(logMutex);
                     std::ofstream badFileStream(*badFile, std::ios::app);
                     badFileStream << replayHash << "\n";
                 }
@@ -339,6 +356,59 @@ void loopReplayFiles(const fs::path &replayFolder,
 
         SPDLOG_INFO("Completed {} of {} replays", ++nComplete, replayHashes.size());
     }
+
+    // Wait for this worker's background writer to drain before reporting completion
+    converter->flushWrites();
+}
+
+/**
+ * @brief Run over a vector of replay hashes that are contained in a replay folder and convert them, spreading the
+ * queue over one worker per converter instance. Workers share the known-hash set and write into one database through
+ * the converters' shared state.
+ * @tparam T replay data structure type
+ * @param replayFolder folder which contains the replay files
+ * @param replayHashes vector of all the replay file hashes to convert
+ * @param gamePath path to sc2 game version folders
+ * @param converters one converter instance per worker, all attached to the same shared state
+ * @param badFile optional file to log bad replays encountered
+ * @param perfPath optional file to log time taken to convert a replay
+ * @param port base port to run the game api servers at
+ */
+template<typename T>
+void loopReplayFiles(const fs::path &replayFolder,
+    const std::vector<std::string> &replayHashes,
+    const std::string &gamePath,
+    const std::vector<std::unique_ptr<cvt::BaseConverter<T>>> &converters,
+    std::optional<fs::path> badFile,
+    std::optional<fs::path> perfPath,
+    int port)
+{
+    std::atomic<std::size_t> nextReplay{ 0 };
+    std::atomic<std::size_t> nComplete{ 0 };
+    std::mutex logMutex{};
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(converters.size());
+        for (std::size_t workerIdx = 0; workerIdx < converters.size(); ++workerIdx) {
+            workers.emplace_back([&, workerIdx]() {
+                convertReplayWorker(workerIdx,
+                    replayFolder,
+                    replayHashes,
+                    gamePath,
+                    converters[workerIdx].get(),
+                    badFile,
+                    perfPath,
+                    port,
+                    nextReplay,
+                    nComplete,
+                    logMutex);
+            });
+        }
+    }
+
+    const bool anyFailure =
+        std::ranges::any_of(converters, [](const auto &converter) { return converter->hasWriteFailure(); });
+    if (anyFailure) { SPDLOG_ERROR("One or more replays failed to be written to the database"); }
 }
 
 
@@ -358,6 +428,7 @@ auto main(int argc, char *argv[]) -> int
       ("b,badfile", "File to record a known set of bad replays (to skip).", cxxopts::value<std::string>())
       ("offset", "Offset to apply to partition index", cxxopts::value<int>())
       ("port", "Port for communication with SC2.", cxxopts::value<int>()->default_value("9168"))
+      ("j,jobs", "Number of parallel SC2 instances pulling from the replay queue.", cxxopts::value<std::size_t>()->default_value("1"))
       ("perflog", "Path to log time taken for replay observation.", cxxopts::value<std::string>())
       ("h,help", "Show this help.");
     // clang-format on
@@ -412,7 +483,7 @@ auto main(int argc, char *argv[]) -> int
     }
 
     using ReplayDataType = cvt::ReplayDataSoA;
-    auto converter = [&](const std::string &cvtType) -> std::unique_ptr<cvt::BaseConverter<ReplayDataType>> {
+    auto makeConverter = [&](const std::string &cvtType) -> std::unique_ptr<cvt::BaseConverter<ReplayDataType>> {
         if (cvtType == "full") { return std::make_unique<cvt::FullConverter<ReplayDataType>>(); }
         if (cvtType == "action") { return std::make_unique<cvt::ActionConverter<ReplayDataType>>(); }
         if (cvtType == "strided") {
@@ -428,10 +499,22 @@ auto main(int argc, char *argv[]) -> int
         }
         SPDLOG_ERROR("Got invalid --converter='{}', require [full|action|strided]", cvtType);
         return nullptr;
-    }(cliOpts["converter"].as<std::string>());
+    };
+
+    // One converter (and later one SC2 instance) per worker, all writing through the same shared state
+    const auto nJobs = std::max<std::size_t>(1, cliOpts["jobs"].as<std::size_t>());
+    auto sharedState = std::make_shared<cvt::ConverterSharedState<ReplayDataType>>();
+    std::vector<std::unique_ptr<cvt::BaseConverter<ReplayDataType>>> converters;
+    converters.reserve(nJobs);
+    for (std::size_t idx = 0; idx < nJobs; ++idx) {
+        auto converter = makeConverter(cliOpts["converter"].as<std::string>());
+        if (converter.get() == nullptr) { return -1; }
+        converter->setSharedState(sharedState);
+        converters.emplace_back(std::move(converter));
+    }
+    if (nJobs > 1) { SPDLOG_INFO("Converting with {} parallel SC2 instances", nJobs); }
 
-    if (converter.get() == nullptr) { return -1; }
-    if (!converter->loadDB(dbPath)) {
+    if (!converters.front()->loadDB(dbPath)) {
         SPDLOG_ERROR("Unable to load/create replay db: {}", dbPath.string());
         return -1;
     }
@@ -455,7 +538,7 @@ auto main(int argc, char *argv[]) -> int
             }
             std::ofstream temp(*badFile);
         } else {
-            registerKnownBadReplays(*badFile, converter.get());
+            registerKnownBadReplays(*badFile, converters.front().get());
         }
     }
 
@@ -486,7 +569,11 @@ auto main(int argc, char *argv[]) -> int
 
     // Check if the replayPath argument is a 'single' file, hence the replayFolder folder is the parent
     const auto replayFolder = fs::is_directory(replayPath) ? fs::path(replayPath) : fs::path(replayPath).parent_path();
-    loopReplayFiles(replayFolder, replayFiles, gamePath, converter.get(), badFile, perfPath, cliOpts["port"].as<int>());
+    loopReplayFiles(replayFolder, replayFiles, gamePath, converters, badFile, perfPath, cliOpts["port"].as<int>());
+
+#ifdef SC2_PERF_STATS
+    SPDLOG_INFO("Stage perf stats: {}", cvt::perf::Registry::get().toJson());
+#endif
 
     return 0;
 }
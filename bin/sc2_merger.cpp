@@ -61,12 +61,20 @@ auto mergeDb(cvt::ReplayDatabase<T> &target,
             SPDLOG_WARN("Skipping existing replay {}", hashId);
             continue;
         }
-        const ReplayDataType replayData = source.getEntry(idx);
-        if (replayData.data.gameStep[0] > 1000) {
-            SPDLOG_WARN("Skipping replay {} with initial step {}", hashId, replayData.data.gameStep[0]);
+        // Only the gameStep column is needed for filtering when the entry format supports column reads
+        const auto initialStep = [&]() -> std::uint32_t {
+            if constexpr (cvt::HasColumnInterface<T>) {
+                return source.getEntryColumns(idx, { "gameStep" }).data.gameStep[0];
+            } else {
+                return source.getEntry(idx).data.gameStep[0];
+            }
+        }();
+        if (initialStep > 1000) {
+            SPDLOG_WARN("Skipping replay {} with initial step {}", hashId, initialStep);
             continue;
         }
-        const bool ok = target.addEntry(replayData);
+        // Transfer the compressed bytes directly, merging runs at disk bandwidth instead of codec speed
+        const bool ok = target.addEntryRaw(source.getEntryRaw(idx));
         knownHashes.insert(hashId);
         if (!ok && target.isFull()) { return false; }
     }
@@ -13,12 +13,47 @@
 
 #include "enums.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
 #include <span>
 #include <vector>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 namespace cvt {
 
+namespace detail {
+
+    /**
+     * @brief Expand one byte of bit-packed image data to eight 0/1 bytes in a word, MSB first (bit 7 -> lowest
+     * addressed byte), matching the unpacking order of bit-packed Image<bool> data. Uses BMI2 pdep when the build
+     * targets it (-march=native/AVX2 release builds), otherwise a precomputed 256-entry table.
+     * @param packed byte of eight packed bits
+     * @return word of eight 0/1 bytes
+     */
+    [[nodiscard]] inline auto spreadBitsToBytes(std::uint8_t packed) noexcept -> std::uint64_t
+    {
+#if defined(__BMI2__)
+        return std::byteswap(_pdep_u64(packed, 0x0101010101010101ULL));
+#else
+        static constexpr auto lut = []() consteval {
+            std::array<std::uint64_t, 256> table{};
+            for (std::size_t value = 0; value < table.size(); ++value) {
+                for (std::size_t bit = 0; bit < 8; ++bit) {
+                    table[value] |= static_cast<std::uint64_t>((value >> (7 - bit)) & 1U) << (8 * bit);
+                }
+            }
+            return table;
+        }();
+        return lut[packed];
+#endif
+    }
+
+}// namespace detail
+
 // ------ Basic Data Structs ------
 
 /**
@@ -301,6 +336,169 @@ template<typename T> auto enumToOneHot(Action::TargetType e) noexcept -> std::ve
 }
 
 
+/**
+ * @brief SoA representation of every action in a replay with flat columns rather than nested vectors. The per-action
+ * unit id lists are concatenated into a single column indexed by a CSR-style offsets array, and a second offsets
+ * array groups actions by game step. Each Action in the time-major layout costs an allocation for itself plus one
+ * for its unit_ids list, so this is the on-disk layout for the actions column: decode becomes a handful of bulk
+ * reads instead of millions of small allocations.
+ */
+struct ActionSoA
+{
+    using struct_type = Action;
+
+    /**
+     * @brief unit_ids of every action concatenated, action idx owns [unit_offsets[idx], unit_offsets[idx + 1])
+     */
+    std::vector<UID> unit_ids{};
+
+    /**
+     * @brief CSR offsets into unit_ids, size() + 1 entries
+     */
+    std::vector<std::uint32_t> unit_offsets{};
+
+    std::vector<int> ability_id{};
+    std::vector<Action::TargetType> target_type{};
+    std::vector<Action::Target> target{};
+
+    /**
+     * @brief CSR offsets grouping actions by game step, nSteps + 1 entries
+     */
+    std::vector<std::uint32_t> step_offsets{};
+
+    /**
+     * @brief Check equality between columnar action data, comparing the union targets according to their tag
+     * @param other ActionSoA to compare against
+     * @return True if equal
+     */
+    [[nodiscard]] auto operator==(const ActionSoA &other) const noexcept -> bool
+    {
+        bool ret = true;
+        ret &= unit_ids == other.unit_ids;
+        ret &= unit_offsets == other.unit_offsets;
+        ret &= ability_id == other.ability_id;
+        ret &= target_type == other.target_type;
+        ret &= step_offsets == other.step_offsets;
+        if (!ret) { return false; }
+
+        for (std::size_t idx = 0; idx < target_type.size(); ++idx) {
+            switch (target_type[idx]) {
+            case Action::TargetType::Position:
+                ret &= target[idx].point == other.target[idx].point;
+                break;
+            case Action::TargetType::OtherUnit:
+                ret &= target[idx].other == other.target[idx].other;
+                break;
+            case Action::TargetType::Self:
+                break;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Number of actions in the Structure-of-Arrays
+     * @return Number of actions
+     */
+    [[nodiscard]] inline auto size() const noexcept -> std::size_t { return ability_id.size(); }
+
+    /**
+     * @brief Number of game steps grouped by step_offsets
+     * @return Number of game steps
+     */
+    [[nodiscard]] inline auto numSteps() const noexcept -> std::size_t
+    {
+        return step_offsets.empty() ? 0 : step_offsets.size() - 1;
+    }
+
+    /**
+     * @brief Gather action data at index
+     * @param idx index in SoA to gather data from
+     * @return Action
+     */
+    [[nodiscard]] auto operator[](std::size_t idx) const noexcept -> Action
+    {
+        Action action;
+        action.unit_ids.assign(std::next(unit_ids.begin(), unit_offsets[idx]),
+            std::next(unit_ids.begin(), unit_offsets[idx + 1]));
+        action.ability_id = ability_id[idx];
+        action.target_type = target_type[idx];
+        action.target = target[idx];
+        return action;
+    }
+};
+
+/**
+ * @brief Flatten time-major action data to columnar form, every column sized exactly in a pre-pass.
+ * @param stepActions actions grouped by game step
+ * @return ActionSoA with CSR offsets for the unit id lists and per-step grouping
+ */
+[[nodiscard]] inline auto flattenActions(const std::vector<std::vector<Action>> &stepActions) noexcept -> ActionSoA
+{
+    std::size_t nActions = 0;
+    std::size_t nUnitIds = 0;
+    for (const auto &actions : stepActions) {
+        nActions += actions.size();
+        for (const auto &action : actions) { nUnitIds += action.unit_ids.size(); }
+    }
+
+    ActionSoA result;
+    result.unit_ids.reserve(nUnitIds);
+    result.unit_offsets.reserve(nActions + 1);
+    result.ability_id.reserve(nActions);
+    result.target_type.reserve(nActions);
+    result.target.reserve(nActions);
+    result.step_offsets.reserve(stepActions.size() + 1);
+
+    result.unit_offsets.push_back(0);
+    result.step_offsets.push_back(0);
+    for (const auto &actions : stepActions) {
+        for (const auto &action : actions) {
+            result.unit_ids.insert(result.unit_ids.end(), action.unit_ids.begin(), action.unit_ids.end());
+            result.unit_offsets.push_back(static_cast<std::uint32_t>(result.unit_ids.size()));
+            result.ability_id.push_back(action.ability_id);
+            result.target_type.push_back(action.target_type);
+            result.target.push_back(action.target);
+        }
+        result.step_offsets.push_back(static_cast<std::uint32_t>(result.ability_id.size()));
+    }
+    return result;
+}
+
+/**
+ * @brief Recover a [start, start + count) step window of columnar action data back to time-major, every inner
+ * vector exact-reserved from the offsets.
+ * @param actionsSoA columnar action data to transform back to time-major
+ * @param start first step of the window
+ * @param count number of steps in the window
+ * @return Actions grouped by game step for the window steps, indexed relative to start
+ */
+[[nodiscard]] inline auto recoverActionsWindow(const ActionSoA &actionsSoA,
+    std::size_t start,
+    std::size_t count) noexcept -> std::vector<std::vector<Action>>
+{
+    const auto end = std::min(actionsSoA.numSteps(), start + count);
+    std::vector<std::vector<Action>> stepActions(end > start ? end - start : 0);
+    for (std::size_t step = start; step < end; ++step) {
+        auto &actions = stepActions[step - start];
+        actions.reserve(actionsSoA.step_offsets[step + 1] - actionsSoA.step_offsets[step]);
+        for (std::uint32_t idx = actionsSoA.step_offsets[step]; idx < actionsSoA.step_offsets[step + 1]; ++idx) {
+            actions.emplace_back(actionsSoA[idx]);
+        }
+    }
+    return stepActions;
+}
+
+/**
+ * @brief Recover columnar action data back to time-major
+ * @param actionsSoA columnar action data to transform back to time-major
+ * @return Actions grouped by game step
+ */
+[[nodiscard]] inline auto recoverActions(const ActionSoA &actionsSoA) noexcept -> std::vector<std::vector<Action>>
+{
+    return recoverActionsWindow(actionsSoA, 0, actionsSoA.numSteps());
+}
+
 }// namespace cvt
 
 /**
@@ -15,6 +15,15 @@
 #include "replay_interface.hpp"
 #include "units.hpp"
 
+#include <boost/iostreams/device/back_inserter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <span>
+#include <unordered_set>
+#include <utility>
+
 namespace cvt {
 
 /**
@@ -110,16 +119,320 @@ using ReplayDataSoA = ReplayDataTemplateSoA<StepDataSoA>;
 
 static_assert(std::same_as<ReplayDataSoA::struct_type, ReplayData>);
 
+namespace detail {
+
+/**
+ * @brief Entry format version which stores the gameStep and sorted unit id columns as zigzag-delta varints rather
+ * than raw integers.
+ */
+constexpr std::size_t gVarintVersion = 2;
+
+/**
+ * @brief Entry format version which stores each column as an independently compressed blob behind an offset table, so
+ * a subset of columns can be read without decompressing the rest.
+ */
+constexpr std::size_t gColumnarVersion = 3;
+
+/**
+ * @brief Entry format version which stores the minimap columns as temporal deltas (XOR against the previous frame)
+ * with periodic keyframes. Consecutive frames differ in a few percent of pixels so the deltas are mostly zero and
+ * compress far better than independent frames.
+ */
+constexpr std::size_t gDeltaMinimapVersion = 4;
+
+/**
+ * @brief Entry format version which stores the actions column as an ActionSoA with CSR offsets for the per-action
+ * unit id lists and per-step grouping, so action decode is a handful of bulk reads rather than an allocation per
+ * action. This is the version new entries are written with.
+ */
+constexpr std::size_t gActionSoAVersion = 5;
+
+/**
+ * @brief Interval at which a delta-encoded minimap frame is stored raw rather than as a delta against its
+ * predecessor, bounding the reconstruction chain length.
+ */
+constexpr std::size_t gMinimapKeyframeInterval = 32;
+
+/**
+ * @brief Serialize a minimap column with each frame XORed against its predecessor, storing a raw keyframe every
+ * gMinimapKeyframeInterval frames. XOR works uniformly on the byte buffer for both bit-packed Image<bool> and enum
+ * layers, and unchanged pixels become zero bytes which the entry codec then collapses.
+ * @tparam T pixel type of the minimap layer
+ * @param frames minimap column to serialize
+ * @param stream output stream to write data
+ */
+template<typename T> void serializeImageDeltas(const std::vector<Image<T>> &frames, std::ostream &stream)
+{
+    serialize(frames.size(), stream);
+    std::vector<std::byte> delta{};
+    for (std::size_t idx = 0; idx < frames.size(); ++idx) {
+        const auto &frame = frames[idx];
+        serialize(frame._h, stream);
+        serialize(frame._w, stream);
+        // A shape change also forces a keyframe so deltas are always against an equal-sized buffer
+        const bool keyframe =
+            idx % gMinimapKeyframeInterval == 0 || frames[idx - 1]._data.size() != frame._data.size();
+        if (keyframe) {
+            serialize(frame._data, stream);
+        } else {
+            delta.resize(frame._data.size());
+            std::ranges::transform(frame._data, frames[idx - 1]._data, delta.begin(), std::bit_xor{});
+            serialize(delta, stream);
+        }
+    }
+}
+
+/**
+ * @brief Deserialize a minimap column written by serializeImageDeltas, reapplying each delta to the previously
+ * reconstructed frame.
+ * @tparam T pixel type of the minimap layer
+ * @param frames output reference to write the minimap column
+ * @param stream input stream to read data from
+ */
+template<typename T> void deserializeImageDeltas(std::vector<Image<T>> &frames, std::istream &stream)
+{
+    std::size_t nFrames = 0;
+    deserialize(nFrames, stream);
+    frames.resize(nFrames);
+    for (std::size_t idx = 0; idx < nFrames; ++idx) {
+        auto &frame = frames[idx];
+        deserialize(frame._h, stream);
+        deserialize(frame._w, stream);
+        deserialize(frame._data, stream);
+        const bool keyframe =
+            idx % gMinimapKeyframeInterval == 0 || frames[idx - 1]._data.size() != frame._data.size();
+        if (!keyframe) {
+            std::ranges::transform(frame._data, frames[idx - 1]._data, frame._data.begin(), std::bit_xor{});
+        }
+    }
+}
+
+/**
+ * @brief Names of the entry columns in blob order for the columnar format, the entry header followed by each
+ * StepDataSoA field.
+ */
+inline constexpr std::array gReplayAllColumns = { "header",
+    "gameStep",
+    "minearals",
+    "vespene",
+    "popMax",
+    "popArmy",
+    "popWorkers",
+    "score",
+    "visibility",
+    "creep",
+    "player_relative",
+    "alerts",
+    "buildable",
+    "pathable",
+    "actions",
+    "units",
+    "neutralUnits" };
+
+/**
+ * @brief Serialize one column into an independently decompressible blob, prefixed with its codec tag byte.
+ * @param codec codec to compress the column with
+ * @param writeColumn function that serializes the column into the compression stream
+ * @return Compressed column blob
+ */
+template<std::invocable<std::ostream &> WriteFn>
+[[nodiscard]] auto compressColumn(Codec codec, WriteFn &&writeColumn) -> std::vector<char>
+{
+    namespace bio = boost::iostreams;
+    perf::ScopedTimer perfTimer(perf::Stage::Compress);
+    std::vector<char> blob{ static_cast<char>(codec) };
+    bio::filtering_ostream filterStream{};
+    pushCompressor(filterStream, codec);
+    filterStream.push(bio::back_inserter(blob));
+    writeColumn(filterStream);
+    filterStream.reset();// Flush the compressor into the blob
+    perfTimer.addBytes(blob.size());
+    return blob;
+}
+
+/**
+ * @brief Deserialize one column from a blob written by compressColumn, inferring the codec from the tag byte.
+ * @param blob compressed column blob
+ * @param readColumn function that deserializes the column from the decompression stream
+ */
+template<std::invocable<std::istream &> ReadFn> void decompressColumn(std::span<const char> blob, ReadFn &&readColumn)
+{
+    namespace bio = boost::iostreams;
+    perf::ScopedTimer perfTimer(perf::Stage::Decompress, blob.size());
+    const auto [codec, isTagged] = codecFromFirstByte(static_cast<std::uint8_t>(blob.front()));
+    const std::size_t offset = isTagged ? 1 : 0;
+    bio::filtering_istream filterStream{};
+    pushDecompressor(filterStream, codec);
+    filterStream.push(bio::array_source(blob.data() + offset, blob.size() - offset));
+    readColumn(filterStream);
+    filterStream.reset();
+}
+
+/**
+ * @brief Deserialize only a [start, start + count) frame window of a minimap column written by
+ * serializeImageDeltas. Frames before the window are reconstructed and discarded to satisfy the delta chain, the
+ * column is abandoned once the window is complete, so at most one frame plus the window is resident.
+ * @tparam T pixel type of the minimap layer
+ * @param frames output reference to write the window frames
+ * @param stream input stream to read data from
+ * @param start first frame of the window
+ * @param count number of frames in the window
+ */
+template<typename T>
+void deserializeImageDeltasWindow(std::vector<Image<T>> &frames, std::istream &stream, std::size_t start, std::size_t count)
+{
+    std::size_t nFrames = 0;
+    deserialize(nFrames, stream);
+    const auto end = std::min(nFrames, start + count);
+    frames.clear();
+    frames.reserve(end > start ? end - start : 0);
+    Image<T> previous{};
+    Image<T> current{};
+    for (std::size_t idx = 0; idx < end; ++idx) {
+        deserialize(current._h, stream);
+        deserialize(current._w, stream);
+        deserialize(current._data, stream);
+        const bool keyframe = idx % gMinimapKeyframeInterval == 0 || previous._data.size() != current._data.size();
+        if (!keyframe) {
+            std::ranges::transform(current._data, previous._data, current._data.begin(), std::bit_xor{});
+        }
+        if (idx >= start) { frames.emplace_back(current); }
+        std::swap(previous, current);
+    }
+}
+
+/**
+ * @brief Read the remainder of a legacy (unversioned) entry header whose leading replayHash length has already been
+ * consumed from the stream.
+ * @param hashLength length of the replayHash string read from the stream
+ * @param dbStream input stream positioned after the replayHash length
+ * @return Entry header
+ */
+inline auto readLegacyHeader(std::size_t hashLength, std::istream &dbStream) -> ReplayInfo
+{
+    ReplayInfo header;
+    header.replayHash.resize(hashLength);
+    dbStream.read(header.replayHash.data(), static_cast<std::streamsize>(hashLength));
+    deserialize(header.gameVersion, dbStream);
+    deserialize(header.playerId, dbStream);
+    deserialize(header.durationSteps, dbStream);
+    deserialize(header.playerRace, dbStream);
+    deserialize(header.playerResult, dbStream);
+    deserialize(header.playerMMR, dbStream);
+    deserialize(header.playerAPM, dbStream);
+    deserialize(header.mapWidth, dbStream);
+    deserialize(header.mapHeight, dbStream);
+    deserialize(header.heightMap, dbStream);
+    return header;
+}
+
+/**
+ * @brief Read the entry header, handling the columnar, varint and legacy layouts. Versioned entries begin with
+ * gMaxRangeSize + version, which a legacy entry can never start with since its first word is the replayHash length
+ * (bounded by gMaxRangeSize).
+ * @param dbStream input stream positioned at the start of the entry
+ * @return header and on-disk format version of the entry
+ */
+inline auto readVersionedHeader(std::istream &dbStream) -> std::pair<ReplayInfo, std::size_t>
+{
+    std::size_t firstWord = 0;
+    deserialize(firstWord, dbStream);
+    if (firstWord <= gMaxRangeSize) { return { readLegacyHeader(firstWord, dbStream), 1 }; }
+
+    const auto version = firstWord - gMaxRangeSize;
+    ReplayInfo header;
+    if (version >= gColumnarVersion) {
+        // Only the header blob needs to be read and decompressed
+        std::vector<std::size_t> columnSizes;
+        deserialize(columnSizes, dbStream);
+        std::vector<char> blob(columnSizes.front());
+        dbStream.read(blob.data(), static_cast<std::streamsize>(blob.size()));
+        decompressColumn(blob, [&header](std::istream &stream) { deserialize(header, stream); });
+    } else {
+        deserialize(header, dbStream);
+    }
+    return { std::move(header), version };
+}
+
+/**
+ * @brief Serialize flattened unit data with the instance-sorted id column as delta varints. The id column is
+ * monotonic after flattenAndSortDataPar so deltas are small; the remaining columns are written as before.
+ * @tparam SoA flattened struct-of-arrays type whose first field is the sorted id column
+ * @param flat flattened unit data to serialize
+ * @param stream output stream to write data
+ */
+template<IsSoAType SoA> void serializeFlattenedVarint(const FlattenedData2<SoA> &flat, std::ostream &stream)
+{
+    serializeDeltaVarint(flat.data.id, stream);
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (serialize(boost::pfr::get<I + 1>(flat.data), stream), ...);
+    }(std::make_index_sequence<boost::pfr::tuple_size_v<SoA> - 1>{});
+    serialize(flat.step_count, stream);
+    serialize(flat.max_step, stream);
+}
+
+/**
+ * @brief Deserialize flattened unit data written by serializeFlattenedVarint.
+ * @tparam SoA flattened struct-of-arrays type whose first field is the sorted id column
+ * @param flat output reference to write flattened unit data
+ * @param stream input stream to read data from
+ */
+template<IsSoAType SoA> void deserializeFlattenedVarint(FlattenedData2<SoA> &flat, std::istream &stream)
+{
+    deserializeDeltaVarint(flat.data.id, stream);
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        (deserialize(boost::pfr::get<I + 1>(flat.data), stream), ...);
+    }(std::make_index_sequence<boost::pfr::tuple_size_v<SoA> - 1>{});
+    deserialize(flat.step_count, stream);
+    deserialize(flat.max_step, stream);
+}
+
+/**
+ * @brief Serialize columnar action data, the monotonic CSR offset columns as zigzag-delta varints and the remaining
+ * columns as bulk contiguous writes.
+ * @param actions columnar action data to serialize
+ * @param stream output stream to write data
+ */
+inline void serializeActionsSoA(const ActionSoA &actions, std::ostream &stream)
+{
+    serialize(actions.unit_ids, stream);
+    serializeDeltaVarint(actions.unit_offsets, stream);
+    serialize(actions.ability_id, stream);
+    serialize(actions.target_type, stream);
+    serialize(actions.target, stream);
+    serializeDeltaVarint(actions.step_offsets, stream);
+}
+
+/**
+ * @brief Deserialize columnar action data written by serializeActionsSoA.
+ * @param actions output reference to write columnar action data
+ * @param stream input stream to read data from
+ */
+inline void deserializeActionsSoA(ActionSoA &actions, std::istream &stream)
+{
+    deserialize(actions.unit_ids, stream);
+    deserializeDeltaVarint(actions.unit_offsets, stream);
+    deserialize(actions.ability_id, stream);
+    deserialize(actions.target_type, stream);
+    deserialize(actions.target, stream);
+    deserializeDeltaVarint(actions.step_offsets, stream);
+}
+
+}// namespace detail
+
 /**
  * @brief Database interface implementation for ReplayDataSoA
  */
 template<> struct DatabaseInterface<ReplayDataSoA>
 {
+    /**
+     * @brief Columns are compressed independently within the entry, the database must not compress on top.
+     */
+    using packs_own_compression = std::true_type;
+
     static auto getHeaderImpl(std::istream &dbStream) -> ReplayInfo
     {
-        ReplayInfo result;
-        deserialize(result, dbStream);
-        return result;
+        return detail::readVersionedHeader(dbStream).first;
     }
 
     static auto getEntryUIDImpl(std::istream &dbStream) -> std::string
@@ -130,9 +443,29 @@ template<> struct DatabaseInterface<ReplayDataSoA>
 
     static auto getEntryImpl(std::istream &dbStream) -> ReplayDataSoA
     {
+        return DatabaseInterface::getEntryColumnsImpl(dbStream, {});
+    }
+
+    /**
+     * @brief Deserialize a pre-columnar (sequentially packed) entry whose leading word has already been consumed.
+     * @param dbStream input stream positioned after the first word of the entry
+     * @param firstWord first word of the entry, the replayHash length for legacy entries or the versioned sentinel
+     * @return Fully decoded entry
+     */
+    static auto readSequentialEntry(std::istream &dbStream, std::size_t firstWord) -> ReplayDataSoA
+    {
+        const std::size_t version = firstWord > gMaxRangeSize ? firstWord - gMaxRangeSize : 1;
         ReplayDataSoA result;
-        deserialize(result.header, dbStream);
-        deserialize(result.data.gameStep, dbStream);
+        if (version == 1) {
+            result.header = detail::readLegacyHeader(firstWord, dbStream);
+        } else {
+            deserialize(result.header, dbStream);
+        }
+        if (version >= detail::gVarintVersion) {
+            deserializeDeltaVarint(result.data.gameStep, dbStream);
+        } else {
+            deserialize(result.data.gameStep, dbStream);
+        }
         deserialize(result.data.minearals, dbStream);
         deserialize(result.data.vespene, dbStream);
         deserialize(result.data.popMax, dbStream);
@@ -148,40 +481,275 @@ template<> struct DatabaseInterface<ReplayDataSoA>
         deserialize(result.data.actions, dbStream);
         {
             FlattenedData2<UnitSoA> units;
-            deserialize(units, dbStream);
-            result.data.units = recoverFlattenedSortedData2(units);
+            if (version >= detail::gVarintVersion) {
+                detail::deserializeFlattenedVarint(units, dbStream);
+            } else {
+                deserialize(units, dbStream);
+            }
+            result.data.units = recoverFlattenedSortedData2Par(units);
         }
         {
             FlattenedData2<NeutralUnitSoA> units;
-            deserialize(units, dbStream);
-            result.data.neutralUnits = recoverFlattenedSortedData2(units);
+            if (version >= detail::gVarintVersion) {
+                detail::deserializeFlattenedVarint(units, dbStream);
+            } else {
+                deserialize(units, dbStream);
+            }
+            result.data.neutralUnits = recoverFlattenedSortedData2Par(units);
         }
         return result;
     }
 
-    static auto addEntryImpl(const ReplayDataSoA &d, std::ostream &dbStream) noexcept -> bool
+    static auto getEntryColumnsImpl(std::istream &dbStream, const std::unordered_set<std::string> &columns)
+        -> ReplayDataSoA
+    {
+        for (const auto &column : columns) {
+            if (!std::ranges::contains(detail::gReplayAllColumns, column)) {
+                throw std::out_of_range{ fmt::format("Entry column \"{}\" doesn't exist", column) };
+            }
+        }
+
+        ReplayDataSoA result;
+        std::size_t firstWord = 0;
+        deserialize(firstWord, dbStream);
+        const std::size_t version = firstWord > gMaxRangeSize ? firstWord - gMaxRangeSize : 1;
+
+        // Pre-columnar layouts are packed sequentially so every column must be deserialized to advance the stream
+        if (version < detail::gColumnarVersion) { return DatabaseInterface::readSequentialEntry(dbStream, firstWord); }
+
+        // Columnar layout: decompress selected columns, skip over the rest using the blob size table
+        std::vector<std::size_t> columnSizes;
+        deserialize(columnSizes, dbStream);
+        if (columnSizes.size() != detail::gReplayAllColumns.size()) {
+            throw std::runtime_error{ fmt::format(
+                "Entry column table has {} entries, expected {}", columnSizes.size(), detail::gReplayAllColumns.size()) };
+        }
+
+        const bool loadAll = columns.empty();
+        std::size_t columnIdx = 0;
+        auto loadOrSkip = [&](auto &&readColumn) {
+            const auto blobSize = columnSizes[columnIdx];
+            const auto *columnName = detail::gReplayAllColumns[columnIdx];
+            ++columnIdx;
+            // The header is always loaded, it identifies the entry and holds the heightMap minimap layer
+            if (loadAll || columnIdx == 1 || columns.contains(columnName)) {
+                std::vector<char> blob(blobSize);
+                dbStream.read(blob.data(), static_cast<std::streamsize>(blobSize));
+                detail::decompressColumn(blob, readColumn);
+            } else {
+                dbStream.ignore(static_cast<std::streamsize>(blobSize));
+            }
+        };
+        loadOrSkip([&](std::istream &stream) { deserialize(result.header, stream); });
+        loadOrSkip([&](std::istream &stream) { deserializeDeltaVarint(result.data.gameStep, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.minearals, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.vespene, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.popMax, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.popArmy, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.popWorkers, stream); });
+        loadOrSkip([&](std::istream &stream) { deserialize(result.data.score, stream); });
+        auto loadMinimapColumn = [&](auto &column) {
+            loadOrSkip([&](std::istream &stream) {
+                if (version >= detail::gDeltaMinimapVersion) {
+                    detail::deserializeImageDeltas(column, stream);
+                } else {
+                    deserialize(column, stream);
+                }
+            });
+        };
+        loadMinimapColumn(result.data.visibility);
+        loadMinimapColumn(result.data.creep);
+        loadMinimapColumn(result.data.player_relative);
+        loadMinimapColumn(result.data.alerts);
+        loadMinimapColumn(result.data.buildable);
+        loadMinimapColumn(result.data.pathable);
+        loadOrSkip([&](std::istream &stream) {
+            if (version >= detail::gActionSoAVersion) {
+                ActionSoA actions;
+                detail::deserializeActionsSoA(actions, stream);
+                result.data.actions = recoverActions(actions);
+            } else {
+                deserialize(result.data.actions, stream);
+            }
+        });
+        loadOrSkip([&](std::istream &stream) {
+            FlattenedData2<UnitSoA> units;
+            detail::deserializeFlattenedVarint(units, stream);
+            result.data.units = recoverFlattenedSortedData2Par(units);
+        });
+        loadOrSkip([&](std::istream &stream) {
+            FlattenedData2<NeutralUnitSoA> units;
+            detail::deserializeFlattenedVarint(units, stream);
+            result.data.neutralUnits = recoverFlattenedSortedData2Par(units);
+        });
+        return result;
+    }
+
+    /**
+     * @brief Decode only the [start, start + count) step window of an entry. The minimap and unit columns, which
+     * dominate entry memory, are decoded windowed so peak memory is bounded by the window length rather than the
+     * replay length; the small scalar and action columns are decoded fully and trimmed. Pre-columnar entries fall
+     * back to a full decode before trimming.
+     * @param dbStream input stream positioned at the start of the entry
+     * @param start first step of the window
+     * @param count number of steps in the window
+     * @return Entry with only the window steps resident, indexed relative to start
+     */
+    static auto getEntryRangeImpl(std::istream &dbStream, std::size_t start, std::size_t count) -> ReplayDataSoA
+    {
+        auto trimToWindow = [start, count](auto &column) {
+            const auto end = std::min(column.size(), start + count);
+            column.erase(column.begin() + static_cast<std::ptrdiff_t>(end), column.end());
+            column.erase(column.begin(), column.begin() + static_cast<std::ptrdiff_t>(std::min(start, column.size())));
+        };
+
+        ReplayDataSoA result;
+        std::size_t firstWord = 0;
+        deserialize(firstWord, dbStream);
+        const std::size_t version = firstWord > gMaxRangeSize ? firstWord - gMaxRangeSize : 1;
+
+        if (version < detail::gColumnarVersion) {
+            result = DatabaseInterface::readSequentialEntry(dbStream, firstWord);
+            trimToWindow(result.data.gameStep);
+            trimToWindow(result.data.minearals);
+            trimToWindow(result.data.vespene);
+            trimToWindow(result.data.popMax);
+            trimToWindow(result.data.popArmy);
+            trimToWindow(result.data.popWorkers);
+            trimToWindow(result.data.score);
+            trimToWindow(result.data.visibility);
+            trimToWindow(result.data.creep);
+            trimToWindow(result.data.player_relative);
+            trimToWindow(result.data.alerts);
+            trimToWindow(result.data.buildable);
+            trimToWindow(result.data.pathable);
+            trimToWindow(result.data.actions);
+            trimToWindow(result.data.units);
+            trimToWindow(result.data.neutralUnits);
+            return result;
+        }
+
+        std::vector<std::size_t> columnSizes;
+        deserialize(columnSizes, dbStream);
+        if (columnSizes.size() != detail::gReplayAllColumns.size()) {
+            throw std::runtime_error{ fmt::format(
+                "Entry column table has {} entries, expected {}", columnSizes.size(), detail::gReplayAllColumns.size()) };
+        }
+
+        std::size_t columnIdx = 0;
+        auto loadColumn = [&](auto &&readColumn) {
+            std::vector<char> blob(columnSizes[columnIdx]);
+            ++columnIdx;
+            dbStream.read(blob.data(), static_cast<std::streamsize>(blob.size()));
+            detail::decompressColumn(blob, readColumn);
+        };
+        auto loadTrimmed = [&](auto &column) {
+            loadColumn([&](std::istream &stream) { deserialize(column, stream); });
+            trimToWindow(column);
+        };
+        auto loadMinimapWindow = [&](auto &column) {
+            loadColumn([&](std::istream &stream) {
+                if (version >= detail::gDeltaMinimapVersion) {
+                    detail::deserializeImageDeltasWindow(column, stream, start, count);
+                } else {
+                    deserialize(column, stream);
+                    trimToWindow(column);
+                }
+            });
+        };
+        loadColumn([&](std::istream &stream) { deserialize(result.header, stream); });
+        loadColumn([&](std::istream &stream) {
+            deserializeDeltaVarint(result.data.gameStep, stream);
+            trimToWindow(result.data.gameStep);
+        });
+        loadTrimmed(result.data.minearals);
+        loadTrimmed(result.data.vespene);
+        loadTrimmed(result.data.popMax);
+        loadTrimmed(result.data.popArmy);
+        loadTrimmed(result.data.popWorkers);
+        loadTrimmed(result.data.score);
+        loadMinimapWindow(result.data.visibility);
+        loadMinimapWindow(result.data.creep);
+        loadMinimapWindow(result.data.player_relative);
+        loadMinimapWindow(result.data.alerts);
+        loadMinimapWindow(result.data.buildable);
+        loadMinimapWindow(result.data.pathable);
+        loadColumn([&](std::istream &stream) {
+            if (version >= detail::gActionSoAVersion) {
+                ActionSoA actions;
+                detail::deserializeActionsSoA(actions, stream);
+                result.data.actions = recoverActionsWindow(actions, start, count);
+            } else {
+                deserialize(result.data.actions, stream);
+                trimToWindow(result.data.actions);
+            }
+        });
+        loadColumn([&](std::istream &stream) {
+            FlattenedData2<UnitSoA> units;
+            detail::deserializeFlattenedVarint(units, stream);
+            result.data.units = recoverFlattenedSortedData2Window(
+                units, static_cast<std::uint32_t>(start), static_cast<std::uint32_t>(count));
+        });
+        loadColumn([&](std::istream &stream) {
+            FlattenedData2<NeutralUnitSoA> units;
+            detail::deserializeFlattenedVarint(units, stream);
+            result.data.neutralUnits = recoverFlattenedSortedData2Window(
+                units, static_cast<std::uint32_t>(start), static_cast<std::uint32_t>(count));
+        });
+        return result;
+    }
+
+    static auto addEntryImpl(const ReplayDataSoA &d, std::ostream &dbStream, Codec codec) noexcept -> bool
     {
-        serialize(d.header, dbStream);
-        serialize(d.data.gameStep, dbStream);
-        serialize(d.data.minearals, dbStream);
-        serialize(d.data.vespene, dbStream);
-        serialize(d.data.popMax, dbStream);
-        serialize(d.data.popArmy, dbStream);
-        serialize(d.data.popWorkers, dbStream);
-        serialize(d.data.score, dbStream);
-        serialize(d.data.visibility, dbStream);
-        serialize(d.data.creep, dbStream);
-        serialize(d.data.player_relative, dbStream);
-        serialize(d.data.alerts, dbStream);
-        serialize(d.data.buildable, dbStream);
-        serialize(d.data.pathable, dbStream);
-        serialize(d.data.actions, dbStream);
-
-        auto cmp = [](auto &&a, auto &&b) { return a.second.id < b.second.id; };
-        serialize(flattenAndSortData2<UnitSoA>(d.data.units, cmp), dbStream);
-        serialize(flattenAndSortData2<NeutralUnitSoA>(d.data.neutralUnits, cmp), dbStream);
+        serialize(gMaxRangeSize + detail::gActionSoAVersion, dbStream);
+
+        std::vector<std::vector<char>> blobs;
+        blobs.reserve(detail::gReplayAllColumns.size());
+        auto addColumn = [&](auto &&writeColumn) { blobs.emplace_back(detail::compressColumn(codec, writeColumn)); };
+        addColumn([&](std::ostream &stream) { serialize(d.header, stream); });
+        addColumn([&](std::ostream &stream) { serializeDeltaVarint(d.data.gameStep, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.minearals, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.vespene, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.popMax, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.popArmy, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.popWorkers, stream); });
+        addColumn([&](std::ostream &stream) { serialize(d.data.score, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.visibility, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.creep, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.player_relative, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.alerts, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.buildable, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeImageDeltas(d.data.pathable, stream); });
+        addColumn([&](std::ostream &stream) { detail::serializeActionsSoA(flattenActions(d.data.actions), stream); });
+
+        auto unitKey = [](const auto &unit) { return unit.id; };
+        addColumn([&](std::ostream &stream) {
+            const auto flattened = [&] {
+                perf::ScopedTimer perfTimer(perf::Stage::Flatten);
+                return flattenAndSortDataPar<UnitSoA>(d.data.units, unitKey);
+            }();
+            detail::serializeFlattenedVarint(flattened, stream);
+        });
+        addColumn([&](std::ostream &stream) {
+            const auto flattened = [&] {
+                perf::ScopedTimer perfTimer(perf::Stage::Flatten);
+                return flattenAndSortDataPar<NeutralUnitSoA>(d.data.neutralUnits, unitKey);
+            }();
+            detail::serializeFlattenedVarint(flattened, stream);
+        });
+
+        std::vector<std::size_t> columnSizes;
+        columnSizes.reserve(blobs.size());
+        std::ranges::transform(blobs, std::back_inserter(columnSizes), [](const auto &blob) { return blob.size(); });
+        serialize(columnSizes, dbStream);
+        for (const auto &blob : blobs) { dbStream.write(blob.data(), static_cast<std::streamsize>(blob.size())); }
         return true;
     }
+
+    static auto addEntryImpl(const ReplayDataSoA &d, std::ostream &dbStream) noexcept -> bool
+    {
+        return DatabaseInterface::addEntryImpl(d, dbStream, Codec::Zlib);
+    }
 };
 
 }// namespace cvt
@@ -13,19 +13,34 @@
 
 #pragma once
 
+#include "perf_stats.hpp"
+#include "replay_cache.hpp"
 #include "serialize.hpp"
 
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <spdlog/fmt/chrono.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace cvt {
@@ -42,6 +57,106 @@ void setReplayDBLoggingLevel(spdlog::level::level_enum lvl) noexcept;
 extern std::shared_ptr<spdlog::logger> gLoggerDB;
 
 
+/**
+ * @brief Compression codec applied to each database entry. New entries are prefixed with the codec value as a single
+ * tag byte, legacy databases contain untagged zlib streams which are recognised by the zlib stream header. None
+ * indicates the entry bytes are stored raw at the entry level because the entry format compresses its own payload
+ * (e.g. independently compressed columns).
+ */
+enum class Codec : std::uint8_t { Zlib = 1, Zstd = 2, None = 3 };
+
+namespace detail {
+
+    /**
+     * @brief First byte of a zlib stream (deflate, 32K window) which prefixes every entry of legacy databases
+     * written before codec tagging was introduced.
+     */
+    constexpr std::uint8_t gZlibStreamFirstByte = 0x78;
+
+    /**
+     * @brief Magic word leading a version 2 database container ("SC2DBv2\0" little-endian). Version 1 files instead
+     * lead with their entry count, which is bounded by the fixed table size, so the formats are unambiguous.
+     */
+    constexpr std::uint64_t gContainerMagicV2 = 0x0032'7642'4432'4353;
+
+    /**
+     * @brief Number of entry offsets held by each index block of a v2 container. A fresh block is chained onto the
+     * index whenever the previous one fills, so the container has no fixed entry cap.
+     */
+    constexpr std::uint64_t gIndexBlockCapacity = 1024;
+
+    /**
+     * @brief Location and capacity of one index block in a v2 container chain.
+     */
+    struct IndexBlockRef
+    {
+        std::uint64_t offset;
+        std::uint64_t capacity;
+    };
+
+    /**
+     * @brief Determine the entry codec from the first byte of an entry.
+     * @param firstByte leading byte of the database entry
+     * @return Pair of the codec and whether the byte is a tag that must be consumed before decompressing.
+     */
+    [[nodiscard]] inline auto codecFromFirstByte(std::uint8_t firstByte) -> std::pair<Codec, bool>
+    {
+        switch (firstByte) {
+        case static_cast<std::uint8_t>(Codec::Zlib):
+            return { Codec::Zlib, true };
+        case static_cast<std::uint8_t>(Codec::Zstd):
+            return { Codec::Zstd, true };
+        case static_cast<std::uint8_t>(Codec::None):
+            return { Codec::None, true };
+        case gZlibStreamFirstByte:
+            return { Codec::Zlib, false };// Legacy untagged zlib entry
+        default:
+            throw std::runtime_error{ fmt::format("Unrecognised entry codec tag: {:#x}", firstByte) };
+        }
+    }
+
+    /**
+     * @brief Append the compressor matching the codec to the filter chain.
+     * @param filterStream filter chain to append to
+     * @param codec codec to compress with
+     */
+    inline void pushCompressor(boost::iostreams::filtering_ostream &filterStream, Codec codec)
+    {
+        namespace bio = boost::iostreams;
+        switch (codec) {
+        case Codec::Zlib:
+            filterStream.push(bio::zlib_compressor(bio::zlib::best_compression));
+            break;
+        case Codec::Zstd:
+            filterStream.push(bio::zstd_compressor());
+            break;
+        case Codec::None:
+            break;// Entry payload manages its own compression
+        }
+    }
+
+    /**
+     * @brief Append the decompressor matching the codec to the filter chain.
+     * @param filterStream filter chain to append to
+     * @param codec codec to decompress with
+     */
+    inline void pushDecompressor(boost::iostreams::filtering_istream &filterStream, Codec codec)
+    {
+        namespace bio = boost::iostreams;
+        switch (codec) {
+        case Codec::Zlib:
+            filterStream.push(bio::zlib_decompressor());
+            break;
+        case Codec::Zstd:
+            filterStream.push(bio::zstd_decompressor());
+            break;
+        case Codec::None:
+            break;// Entry payload manages its own compression
+        }
+    }
+
+}// namespace detail
+
 /**
  * @brief Interface that tells database how to read/write replay data structure.
  * @tparam ReplayT replay data structure to read/write from database.
@@ -99,6 +214,33 @@ template<typename T> struct DatabaseInterface
 template<typename T>
 concept HasDBInterface = requires { typename DatabaseInterface<T>; };
 
+/**
+ * @brief Entry format compresses its own payload (e.g. per-column) so the database must not apply entry-level
+ * compression on top of it.
+ * @tparam T data structure of the replay
+ */
+template<typename T>
+concept PacksOwnCompression =
+    requires { requires std::same_as<typename DatabaseInterface<T>::packs_own_compression, std::true_type>; };
+
+/**
+ * @brief Database interface supports reading a subset of columns from an entry.
+ * @tparam T data structure of the replay
+ */
+template<typename T>
+concept HasColumnInterface = requires(std::istream &dbStream, const std::unordered_set<std::string> &columns) {
+    { DatabaseInterface<T>::getEntryColumnsImpl(dbStream, columns) } -> std::same_as<T>;
+};
+
+/**
+ * @brief Database interface supports decoding a window of steps from an entry with memory bounded by the window.
+ * @tparam T data structure of the replay
+ */
+template<typename T>
+concept HasRangeInterface = requires(std::istream &dbStream, std::size_t start, std::size_t count) {
+    { DatabaseInterface<T>::getEntryRangeImpl(dbStream, start, count) } -> std::same_as<T>;
+};
+
 /**
  * @brief
  * @tparam T is a DatabaseIO Type that implements interactions with the database
@@ -106,6 +248,11 @@ concept HasDBInterface = requires { typename DatabaseInterface<T>; };
 template<HasDBInterface EntryType> class ReplayDatabase
 {
   public:
+    /**
+     * @brief Metadata type of a database entry
+     */
+    using header_type = typename DatabaseInterface<EntryType>::header_type;
+
     /**
      * @brief Maximum number of allowed entries in a replay database. This is the maximum lookup table size on disk.
      */
@@ -122,6 +269,66 @@ template<HasDBInterface EntryType> class ReplayDatabase
      */
     explicit ReplayDatabase(const std::filesystem::path &dbPath) noexcept { this->open(dbPath); }
 
+    /**
+     * @brief Commit any entries still buffered by batched append mode before the handle goes away.
+     */
+    ~ReplayDatabase() noexcept
+    {
+        try {
+            this->flush();
+        } catch (...) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Failed to flush pending entries to \"{}\"", dbPath_.string());
+        }
+    }
+
+    /**
+     * @brief Serialize and compress an entry into its raw tagged on-disk byte form without appending it. Touches no
+     * database state besides the configured write codec, so the expensive compression can run concurrently on a
+     * worker pool with the resulting bytes committed in order through addEntryRaw.
+     * @param data The replay data to encode.
+     * @return Raw entry bytes suitable for addEntryRaw, empty on serialization or compression failure.
+     */
+    [[nodiscard]] auto makeEntryRaw(const EntryType &data) const -> std::vector<char>
+    {
+        namespace bio = boost::iostreams;
+
+        std::vector<char> rawEntry{};
+        try {
+            // Serialize into one contiguous block first so the compressor sees a few large writes
+            // rather than one tiny write per field
+            BlockBuffer block{};
+            std::ostream blockStream(&block);
+            if constexpr (requires { DatabaseInterface<EntryType>::addEntryImpl(data, blockStream, writeCodec_); }) {
+                DatabaseInterface<EntryType>::addEntryImpl(data, blockStream, writeCodec_);
+            } else {
+                DatabaseInterface<EntryType>::addEntryImpl(data, blockStream);
+            }
+            if (blockStream.bad()) {
+                SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Serializing Replay Data");
+                return {};
+            }
+
+            // Formats with internal per-column compression are stored raw at the entry level
+            const Codec entryCodec = PacksOwnCompression<EntryType> ? Codec::None : writeCodec_;
+            rawEntry.emplace_back(static_cast<char>(entryCodec));
+            perf::ScopedTimer perfTimer(perf::Stage::Compress);
+            bio::filtering_ostream filterStream{};
+            detail::pushCompressor(filterStream, entryCodec);
+            filterStream.push(bio::back_inserter(rawEntry));
+            block.writeTo(filterStream);
+            if (filterStream.bad()) {
+                SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Compressing Replay Data");
+                return {};
+            }
+            filterStream.reset();
+            perfTimer.addBytes(rawEntry.size());
+        } catch (const std::bad_alloc &e) {
+            SPDLOG_LOGGER_CRITICAL(gLoggerDB, "Failed to write replay, got error: {}", e.what());
+            return {};
+        }
+        return rawEntry;
+    }
+
     /**
      * @brief Adds an entry to the replay database.
      * @param data The replay data to be added.
@@ -130,9 +337,8 @@ template<HasDBInterface EntryType> class ReplayDatabase
     [[maybe_unused]] auto addEntry(const EntryType &data) -> bool
     {
         namespace fs = std::filesystem;
-        namespace bio = boost::iostreams;
 
-        // First ensure that the db is not at the maximum 1M entries
+        // First ensure that the db exists and has room for another entry
         if (!fs::exists(dbPath_)) {
             SPDLOG_LOGGER_ERROR(gLoggerDB, "Database \"{}\" doesn't exist", dbPath_.string());
             return false;
@@ -142,48 +348,67 @@ template<HasDBInterface EntryType> class ReplayDatabase
             return false;
         }
 
-        // Get the current endPos of the file
-        std::ofstream dbStream(dbPath_, std::ios::binary | std::ios::ate | std::ios::in);
-        const auto previousEnd = dbStream.tellp();
-
-        // Write compressed data to the end of the file
-        try {
-            bio::filtering_ostream filterStream{};
-            filterStream.push(bio::zlib_compressor(bio::zlib::best_compression));
-            filterStream.push(dbStream);
-            DatabaseInterface<EntryType>::addEntryImpl(data, filterStream);
-            if (filterStream.bad()) {
-                SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Serializing Replay Data");
-                return false;
-            }
-            filterStream.flush();
-            filterStream.reset();
-        } catch (const std::bad_alloc &e) {
-            SPDLOG_LOGGER_CRITICAL(gLoggerDB, "Failed to write replay, got error: {}", e.what());
-            return false;
-        }
+        // Serialize and compress into memory so entries can be batched and land with a single file write
+        auto rawEntry = this->makeEntryRaw(data);
+        if (rawEntry.empty()) { return false; }
 
-        // Calculate offset of start of db entry
-        dbStream.seekp(0, std::ios::beg);
-        entryPtr_.emplace_back(previousEnd - dbStream.tellp());
+        return this->queuePendingEntry(std::move(rawEntry));
+    }
 
-        // Write Offset (index) is nEntries - 1 + sizeof(nEntries)
-        const std::size_t nEntries = entryPtr_.size();
-        constexpr auto elementSize = sizeof(std::ranges::range_value_t<decltype(entryPtr_)>);
-        dbStream.seekp((nEntries - 1) * elementSize + sizeof(std::size_t), std::ios::beg);
-        dbStream.write(reinterpret_cast<const char *>(&entryPtr_.back()), elementSize);
+    /**
+     * @brief Retrieve the compressed on-disk bytes of an entry, including its codec tag, without decompressing.
+     * @param index Index of the entry to read.
+     * @return Raw entry bytes exactly as stored on disk, suitable for addEntryRaw on another database.
+     */
+    [[nodiscard]] auto getEntryRaw(std::size_t index) const -> std::vector<char>
+    {
+        namespace fs = std::filesystem;
+        if (index >= entryPtr_.size()) {
+            throw std::out_of_range(fmt::format("Index {} exceeds database size {}", index, entryPtr_.size()));
+        }
+        const auto begin = static_cast<std::size_t>(entryPtr_[index]);
+        std::size_t end =
+            index + 1 < entryPtr_.size() ? static_cast<std::size_t>(entryPtr_[index + 1]) : fs::file_size(dbPath_);
+        // A v2 index block may have been chained in directly after this entry, clamp to it
+        for (const auto &block : indexBlocks_) {
+            if (block.offset > begin && block.offset < end) { end = block.offset; }
+        }
 
-        // Write Number of Elements in LUT last to confirm the update
-        dbStream.seekp(0, std::ios::beg);
-        dbStream.write(reinterpret_cast<const char *>(&nEntries), sizeof(nEntries));
+        std::vector<char> rawEntry(end - begin);
+        if (mappedFile_.is_open() && end <= mappedFile_.size()) {
+            std::copy_n(mappedFile_.data() + begin, rawEntry.size(), rawEntry.data());
+        } else {
+            std::ifstream dbStream(dbPath_, std::ios::binary);
+            dbStream.seekg(static_cast<std::streamoff>(begin), std::ios::beg);
+            dbStream.read(rawEntry.data(), static_cast<std::streamsize>(rawEntry.size()));
+        }
+        return rawEntry;
+    }
 
-        // Check bad-ness
-        if (dbStream.bad()) {
-            SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Writing Db Offset Entry");
+    /**
+     * @brief Append the raw compressed bytes of an entry copied from another database of the same entry type,
+     * skipping the decompress/recompress cycle entirely. Only the lookup table and sidecar indices are updated, the
+     * entry keeps its original codec and format version, so merging shards runs at disk bandwidth.
+     * @param rawEntry Entry bytes as returned by getEntryRaw.
+     * @return True if the entry was appended successfully.
+     */
+    [[maybe_unused]] auto addEntryRaw(std::span<const char> rawEntry) -> bool
+    {
+        namespace fs = std::filesystem;
+        if (!fs::exists(dbPath_)) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Database \"{}\" doesn't exist", dbPath_.string());
+            return false;
+        }
+        if (this->isFull()) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Database \"{}\" is full", dbPath_.string());
+            return false;
+        }
+        if (rawEntry.empty()) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Refusing to append an empty raw entry");
             return false;
         }
 
-        return true;
+        return this->queuePendingEntry({ rawEntry.begin(), rawEntry.end() });
     }
 
     /**
@@ -193,7 +418,106 @@ template<HasDBInterface EntryType> class ReplayDatabase
      */
     [[nodiscard]] auto getEntry(std::size_t index) const -> EntryType
     {
-        return this->readFromDatabase(index, DatabaseInterface<EntryType>::getEntryImpl);
+        if (entryCache_ != nullptr) {
+            if (auto cached = entryCache_->find(dbPath_, index); cached.has_value()) {
+                boost::iostreams::filtering_istream cacheStream;
+                cacheStream.push(boost::iostreams::array_source(cached->data(), cached->size()));
+                EntryType data;
+                deserialize(data, cacheStream);
+                return data;
+            }
+        }
+        auto data = this->readFromDatabase(index, DatabaseInterface<EntryType>::getEntryImpl);
+        if (entryCache_ != nullptr) {
+            std::vector<char> buffer;
+            boost::iostreams::filtering_ostream cacheStream;
+            cacheStream.push(boost::iostreams::back_inserter(buffer));
+            serialize(data, cacheStream);
+            cacheStream.reset();
+            entryCache_->insert(dbPath_, index, buffer);
+        }
+        return data;
+    }
+
+    /**
+     * @brief Attach a process-shared cache of decoded entries, getEntry then serves hits from the cache and inserts
+     * misses after decoding. Pass nullptr to detach. The same cache instance may be shared between databases, keys
+     * incorporate the database path.
+     * @param cache Cache to serve entry reads from.
+     */
+    void attachCache(std::shared_ptr<SharedReplayCache> cache) noexcept { entryCache_ = std::move(cache); }
+
+    /**
+     * @brief Retrieves a subset of the columns of the entry at the specified index, skipping the read and
+     * decompression of unselected columns when the entry was written in a columnar format. Unselected columns are left
+     * value-initialized in the returned entry.
+     * @param index The index of the replay data entry to retrieve.
+     * @param columns Names of the columns to load, an empty set loads all columns.
+     * @return The replay data at the specified index with only the requested columns populated.
+     */
+    [[nodiscard]] auto getEntryColumns(std::size_t index, const std::unordered_set<std::string> &columns) const
+        -> EntryType
+        requires HasColumnInterface<EntryType>
+    {
+        return this->readFromDatabase(index,
+            [&columns](std::istream &dbStream) { return DatabaseInterface<EntryType>::getEntryColumnsImpl(dbStream, columns); });
+    }
+
+    /**
+     * @brief Retrieves only the [start, start + count) step window of the entry at the specified index, bounding
+     * peak memory by the window length rather than the replay length. The result bypasses the shared entry cache
+     * since it is not the full entry.
+     * @param index The index of the replay data entry to retrieve.
+     * @param start First step of the window.
+     * @param count Number of steps in the window.
+     * @return The replay data at the specified index containing only the window steps, indexed relative to start.
+     */
+    [[nodiscard]] auto getEntryRange(std::size_t index, std::size_t start, std::size_t count) const -> EntryType
+        requires HasRangeInterface<EntryType>
+    {
+        return this->readFromDatabase(index, [start, count](std::istream &dbStream) {
+            return DatabaseInterface<EntryType>::getEntryRangeImpl(dbStream, start, count);
+        });
+    }
+
+    /**
+     * @brief Retrieves a batch of entries, decompressing and deserializing them in parallel over an internal thread
+     * pool. Safe to call concurrently with other reads but not with addEntry.
+     * @param indices Indices of the entries to retrieve, duplicates are allowed.
+     * @return Entries in the same order as the requested indices.
+     */
+    [[nodiscard]] auto getEntries(std::span<const std::size_t> indices) const -> std::vector<EntryType>
+    {
+        std::vector<EntryType> entries(indices.size());
+        const std::size_t nWorkers =
+            std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), indices.size());
+        if (nWorkers < 2) {
+            std::ranges::transform(indices, entries.begin(), [this](std::size_t idx) { return this->getEntry(idx); });
+            return entries;
+        }
+
+        std::atomic<std::size_t> nextItem{ 0 };
+        std::exception_ptr firstError{};
+        std::mutex errorMutex{};
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(nWorkers);
+            for (std::size_t w = 0; w < nWorkers; ++w) {
+                workers.emplace_back([&]() {
+                    for (std::size_t item = nextItem++; item < indices.size(); item = nextItem++) {
+                        try {
+                            entries[item] = this->getEntry(indices[item]);
+                        } catch (...) {
+                            std::scoped_lock lock(errorMutex);
+                            if (!firstError) { firstError = std::current_exception(); }
+                            return;
+                        }
+                    }
+                });
+            }
+        }
+        if (firstError) { std::rethrow_exception(firstError); }
+        return entries;
     }
 
     /**
@@ -201,11 +525,24 @@ template<HasDBInterface EntryType> class ReplayDatabase
      * @param index Index to read from database
      * @return ReplayInfo at index
      */
-    [[nodiscard]] auto getHeader(std::size_t index) const
+    [[nodiscard]] auto getHeader(std::size_t index) const -> header_type
     {
+        // Serve from the header sidecar when loaded, skipping entry decompression entirely
+        if (headerCacheValid_ && index < headerCache_.size()) { return headerCache_[index]; }
         return this->readFromDatabase(index, DatabaseInterface<EntryType>::getHeaderImpl);
     }
 
+    /**
+     * @brief Retrieves the headers of all entries in the database in one sequential read of the header sidecar,
+     * rebuilding (and persisting) the sidecar with a full scan if it is missing or stale.
+     * @return Headers of all entries in database order
+     */
+    [[nodiscard]] auto getAllHeaders() const -> std::vector<header_type>
+    {
+        if (!headerCacheValid_) { this->rebuildHeaderCache(); }
+        return headerCache_;
+    }
+
     /**
      * @brief Retrieves the UID of an entry in the database.
      * @param index The index of the data to retrieve.
@@ -217,16 +554,14 @@ template<HasDBInterface EntryType> class ReplayDatabase
     }
 
     /**
-     * @brief Return a set of all UIDs in the database.
+     * @brief Return a set of all UIDs in the database. Served from the persistent sidecar index when available,
+     * otherwise rebuilt with a full database scan (and persisted for next time).
      * @return Unordered set of std::string
      */
     [[nodiscard]] auto getAllUIDs() const -> std::unordered_set<std::string>
     {
-        std::unordered_set<std::string> replayHashes{};
-        for (auto &&idx : std::views::iota(std::size_t(0), this->size())) {
-            replayHashes.insert(this->getEntryUID(idx));
-        }
-        return replayHashes;
+        if (!uidCacheValid_) { this->rebuildUIDCache(); }
+        return { uidCache_.begin(), uidCache_.end() };
     }
 
     /**
@@ -242,6 +577,7 @@ template<HasDBInterface EntryType> class ReplayDatabase
             return false;
         }
 
+        this->closeWriteHandle();
         dbPath_ = std::move(dbPath);
         if (fs::exists(dbPath_)) {
             return this->loadIndexTable();
@@ -266,6 +602,7 @@ template<HasDBInterface EntryType> class ReplayDatabase
             SPDLOG_LOGGER_ERROR(gLoggerDB, "Database already exists at path: {}", path.string());
             return false;
         }
+        this->closeWriteHandle();
         dbPath_ = std::move(path);
         return this->createNewDatabaseFile();
     }
@@ -286,6 +623,7 @@ template<HasDBInterface EntryType> class ReplayDatabase
             SPDLOG_LOGGER_ERROR(gLoggerDB, "Database does not exist at path: {}", path.string());
             return false;
         }
+        this->closeWriteHandle();
         dbPath_ = std::move(path);
         return this->loadIndexTable();
     }
@@ -297,10 +635,14 @@ template<HasDBInterface EntryType> class ReplayDatabase
     [[nodiscard]] auto size() const noexcept -> std::size_t { return entryPtr_.size(); }
 
     /**
-     * @brief Checks if the replay database is full.
+     * @brief Checks if the replay database is full. Only legacy v1 containers with their fixed lookup table can
+     * fill up, the v2 index chain grows on demand.
      * @return true if the replay database is full, false otherwise.
      */
-    [[nodiscard]] auto isFull() const noexcept -> bool { return entryPtr_.size() >= maxEntries; }
+    [[nodiscard]] auto isFull() const noexcept -> bool
+    {
+        return containerVersion_ == 1 && entryPtr_.size() + pendingSizes_.size() >= maxEntries;
+    }
 
     /**
      * @brief Get the current path of the database instance
@@ -308,6 +650,74 @@ template<HasDBInterface EntryType> class ReplayDatabase
      */
     [[nodiscard]] auto path() const noexcept -> const std::filesystem::path & { return dbPath_; }
 
+    /**
+     * @brief Path to the UID sidecar index that accompanies the database file
+     * @return Database path with ".uidx" appended
+     */
+    [[nodiscard]] auto uidCachePath() const -> std::filesystem::path
+    {
+        auto path = dbPath_;
+        path += ".uidx";
+        return path;
+    }
+
+    /**
+     * @brief Path to the header sidecar that accompanies the database file
+     * @return Database path with ".hidx" appended
+     */
+    [[nodiscard]] auto headerCachePath() const -> std::filesystem::path
+    {
+        auto path = dbPath_;
+        path += ".hidx";
+        return path;
+    }
+
+    /**
+     * @brief Set the codec used to compress entries added to the database. Reading always infers the codec from the
+     * per-entry tag, so databases with mixed codecs are fine.
+     * @param codec Codec new entries are written with
+     */
+    void setWriteCodec(Codec codec) noexcept { writeCodec_ = codec; }
+
+    /**
+     * @brief Get the codec new entries are written with
+     * @return Current write codec
+     */
+    [[nodiscard]] auto getWriteCodec() const noexcept -> Codec { return writeCodec_; }
+
+    /**
+     * @brief Set the number of entries buffered in memory before they are committed to the file in a single data
+     * write and lookup table update. The default of one commits every entry immediately. Buffered entries are not
+     * visible to readers until committed, call flush() at durability points when batching.
+     * @param batchSize Entries per commit, clamped to at least one.
+     */
+    void setBatchSize(std::size_t batchSize) noexcept { batchSize_ = std::max<std::size_t>(batchSize, 1); }
+
+    /**
+     * @brief Commit any entries buffered by batched append mode with one data write and one lookup table update.
+     * No-op when nothing is pending.
+     * @return True if all pending entries were committed successfully.
+     */
+    [[maybe_unused]] auto flush() -> bool
+    {
+        if (pendingSizes_.empty()) { return true; }
+        perf::ScopedTimer perfTimer(perf::Stage::DbWrite, pendingData_.size());
+
+        auto &dbStream = this->writeStream();
+        if (!this->ensureIndexCapacity(dbStream, pendingSizes_.size())) { return false; }
+        dbStream.seekp(0, std::ios::end);
+        const auto previousEnd = dbStream.tellp();
+        dbStream.write(pendingData_.data(), static_cast<std::streamsize>(pendingData_.size()));
+        if (dbStream.bad()) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Writing Replay Data");
+            return false;
+        }
+        const bool ok = this->commitAppendedEntries(dbStream, previousEnd, pendingSizes_);
+        pendingData_.clear();
+        pendingSizes_.clear();
+        return ok;
+    }
+
   private:
     /**
      * @brief Loads the entryPtr_ look up table from an existing database on disk.
@@ -316,17 +726,168 @@ template<HasDBInterface EntryType> class ReplayDatabase
     [[maybe_unused]] auto loadIndexTable() -> bool
     {
         std::ifstream dbStream(dbPath_, std::ios::binary);
-        deserialize(entryPtr_, dbStream);
+
+        // v2 containers lead with a magic word, v1 containers lead with their (bounded) entry count
+        std::uint64_t firstWord{};
+        dbStream.read(reinterpret_cast<char *>(&firstWord), sizeof(firstWord));
+        if (firstWord == detail::gContainerMagicV2) {
+            containerVersion_ = 2;
+            std::uint64_t nEntries{};
+            std::uint64_t blockOffset{};
+            dbStream.read(reinterpret_cast<char *>(&nEntries), sizeof(nEntries));
+            dbStream.read(reinterpret_cast<char *>(&blockOffset), sizeof(blockOffset));
+
+            // Walk the index block chain gathering entry offsets
+            entryPtr_.clear();
+            entryPtr_.reserve(nEntries);
+            indexBlocks_.clear();
+            while (blockOffset != 0 && !dbStream.bad()) {
+                std::uint64_t capacity{};
+                std::uint64_t next{};
+                dbStream.seekg(static_cast<std::streamoff>(blockOffset), std::ios::beg);
+                dbStream.read(reinterpret_cast<char *>(&capacity), sizeof(capacity));
+                dbStream.read(reinterpret_cast<char *>(&next), sizeof(next));
+                indexBlocks_.emplace_back(blockOffset, capacity);
+
+                const auto nUsed = std::min<std::uint64_t>(capacity, nEntries - entryPtr_.size());
+                const auto oldSize = entryPtr_.size();
+                entryPtr_.resize(oldSize + nUsed);
+                dbStream.read(reinterpret_cast<char *>(entryPtr_.data() + oldSize),
+                    static_cast<std::streamsize>(nUsed * sizeof(std::int64_t)));
+                blockOffset = next;
+            }
+            if (entryPtr_.size() != nEntries) {
+                SPDLOG_LOGGER_ERROR(gLoggerDB,
+                    "Index chain of {} yielded {} entries but header declares {}",
+                    dbPath_.string(),
+                    entryPtr_.size(),
+                    nEntries);
+                return false;
+            }
+        } else {
+            containerVersion_ = 1;
+            indexBlocks_.clear();
+            dbStream.seekg(0, std::ios::beg);
+            deserialize(entryPtr_, dbStream);
+        }
 
         const bool ok = !dbStream.bad();
         if (ok) {
             SPDLOG_LOGGER_INFO(gLoggerDB, "Loaded Existing Database Table {}", dbPath_.string());
+            this->remapDatabaseFile();
+            this->loadUIDCache();
+            this->loadHeaderCache();
         } else {
             SPDLOG_LOGGER_ERROR(gLoggerDB, "Failed to Load Existing Database Table {}", dbPath_.string());
         }
         return ok;
     }
 
+    /**
+     * @brief Load the UID sidecar index from disk. If it is missing or its length disagrees with the entry table
+     * (e.g. legacy database or interrupted write) it is discarded and lazily rebuilt by getAllUIDs.
+     */
+    void loadUIDCache()
+    {
+        uidCache_.clear();
+        uidCacheValid_ = false;
+        const auto cachePath = this->uidCachePath();
+        if (!std::filesystem::exists(cachePath)) { return; }
+
+        std::ifstream uidStream(cachePath);
+        std::string line;
+        while (std::getline(uidStream, line)) { uidCache_.emplace_back(std::move(line)); }
+
+        uidCacheValid_ = uidCache_.size() == entryPtr_.size();
+        if (!uidCacheValid_) {
+            SPDLOG_LOGGER_WARN(gLoggerDB,
+                "UID index {} has {} entries but database has {}, will rebuild on demand",
+                cachePath.string(),
+                uidCache_.size(),
+                entryPtr_.size());
+            uidCache_.clear();
+        }
+    }
+
+    /**
+     * @brief Load the header sidecar from disk. Like the UID index, a missing or inconsistent sidecar is discarded
+     * and lazily rebuilt by getAllHeaders.
+     */
+    void loadHeaderCache()
+    {
+        headerCache_.clear();
+        headerCacheValid_ = false;
+        const auto cachePath = this->headerCachePath();
+        if (!std::filesystem::exists(cachePath)) { return; }
+
+        std::ifstream headerStream(cachePath, std::ios::binary);
+        while (headerStream.peek() != std::char_traits<char>::eof()) {
+            header_type header;
+            deserialize(header, headerStream);
+            if (headerStream.bad() || headerStream.fail()) { break; }
+            headerCache_.emplace_back(std::move(header));
+        }
+
+        headerCacheValid_ = headerCache_.size() == entryPtr_.size();
+        if (!headerCacheValid_) {
+            SPDLOG_LOGGER_WARN(gLoggerDB,
+                "Header index {} has {} entries but database has {}, will rebuild on demand",
+                cachePath.string(),
+                headerCache_.size(),
+                entryPtr_.size());
+            headerCache_.clear();
+        }
+    }
+
+    /**
+     * @brief Rebuild the header cache with a full database scan and persist it to the sidecar.
+     */
+    void rebuildHeaderCache() const
+    {
+        SPDLOG_LOGGER_INFO(gLoggerDB, "Rebuilding header index for {}", dbPath_.string());
+        headerCache_.clear();
+        headerCache_.reserve(this->size());
+        for (auto &&idx : std::views::iota(std::size_t(0), this->size())) {
+            headerCache_.emplace_back(this->readFromDatabase(idx, DatabaseInterface<EntryType>::getHeaderImpl));
+        }
+        std::ofstream headerStream(this->headerCachePath(), std::ios::binary | std::ios::trunc);
+        for (auto &&header : headerCache_) { serialize(header, headerStream); }
+        headerCacheValid_ = true;
+    }
+
+    /**
+     * @brief Rebuild the UID cache with a full database scan and persist it to the sidecar index.
+     */
+    void rebuildUIDCache() const
+    {
+        SPDLOG_LOGGER_INFO(gLoggerDB, "Rebuilding UID index for {}", dbPath_.string());
+        uidCache_.clear();
+        uidCache_.reserve(this->size());
+        for (auto &&idx : std::views::iota(std::size_t(0), this->size())) {
+            uidCache_.emplace_back(this->getEntryUID(idx));
+        }
+        std::ofstream uidStream(this->uidCachePath(), std::ios::trunc);
+        for (auto &&uid : uidCache_) { uidStream << uid << '\n'; }
+        uidCacheValid_ = true;
+    }
+
+    /**
+     * @brief (Re)open the memory mapping of the database file used by the zero-copy read path. If mapping fails (e.g.
+     * exotic filesystem) a warning is emitted and reads fall back to buffered ifstream.
+     */
+    void remapDatabaseFile() noexcept
+    {
+        try {
+            if (mappedFile_.is_open()) { mappedFile_.close(); }
+            mappedFile_.open(dbPath_.string());
+        } catch (const std::exception &e) {
+            SPDLOG_LOGGER_WARN(gLoggerDB,
+                "Unable to memory-map \"{}\", falling back to buffered reads: {}",
+                dbPath_.string(),
+                e.what());
+        }
+    }
+
     /**
      * @brief Creates a new empty database.
      * @return true if the database was successfully created, false otherwise.
@@ -334,21 +895,29 @@ template<HasDBInterface EntryType> class ReplayDatabase
     [[maybe_unused]] auto createNewDatabaseFile() -> bool
     {
         entryPtr_.clear();// Clear existing LUT data
+        indexBlocks_.clear();
+        containerVersion_ = 2;
 
-        // Write buffer of zeros in 4k chunks (OS block alignment)
-        std::array<char, 4096> zeros;
-        std::ranges::fill(zeros, 0);
-
-        // Number of chunks of 4k bytes to write (+1 to ceil div)
-        constexpr std::size_t nChunks = (maxEntries * sizeof(std::streampos) + sizeof(std::size_t)) / zeros.size() + 1;
-
-        // Write chunks
+        // v2 header: magic, entry count, offset of the first index block
         std::ofstream dbStream(dbPath_, std::ios::binary);
-        for (std::size_t i = 0; i < nChunks; ++i) { dbStream.write(zeros.data(), sizeof(zeros)); }
+        constexpr std::uint64_t nEntries = 0;
+        constexpr std::uint64_t firstBlock = 3 * sizeof(std::uint64_t);
+        dbStream.write(reinterpret_cast<const char *>(&detail::gContainerMagicV2), sizeof(detail::gContainerMagicV2));
+        dbStream.write(reinterpret_cast<const char *>(&nEntries), sizeof(nEntries));
+        dbStream.write(reinterpret_cast<const char *>(&firstBlock), sizeof(firstBlock));
+        this->writeIndexBlock(dbStream);
+        indexBlocks_.emplace_back(firstBlock, detail::gIndexBlockCapacity);
 
         const bool ok = !dbStream.bad();
         if (ok) {
             SPDLOG_LOGGER_INFO(gLoggerDB, "Created New Database: {}", dbPath_.string());
+            // Start fresh (empty) UID and header sidecar indices alongside the database
+            uidCache_.clear();
+            uidCacheValid_ = true;
+            std::ofstream(this->uidCachePath(), std::ios::trunc);
+            headerCache_.clear();
+            headerCacheValid_ = true;
+            std::ofstream(this->headerCachePath(), std::ios::binary | std::ios::trunc);
         } else {
             SPDLOG_LOGGER_ERROR(gLoggerDB, "Failed to Create New Database: {}", dbPath_.string());
         }
@@ -356,34 +925,216 @@ template<HasDBInterface EntryType> class ReplayDatabase
     }
 
     /**
-     * @brief Read from database at index using pointer to reading function
-     * @tparam T type returned by the reading function
+     * @brief Write an empty index block (capacity, no successor, zeroed offsets) at the current stream position.
+     * @param dbStream Stream positioned where the block should be written.
+     */
+    void writeIndexBlock(std::ofstream &dbStream) const
+    {
+        constexpr std::uint64_t next = 0;
+        dbStream.write(reinterpret_cast<const char *>(&detail::gIndexBlockCapacity), sizeof(detail::gIndexBlockCapacity));
+        dbStream.write(reinterpret_cast<const char *>(&next), sizeof(next));
+        const std::vector<char> zeros(detail::gIndexBlockCapacity * sizeof(std::int64_t), 0);
+        dbStream.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+    }
+
+    /**
+     * @brief Ensure the v2 index chain has free slots for the next entries, appending and linking fresh blocks at
+     * the end of the file as required. Must run before the entries themselves are written so index blocks always
+     * precede the entries they index and the final entry still extends to the end of the file.
+     * @param dbStream Database write stream.
+     * @param nNeeded Number of entries about to be appended.
+     * @return True if enough slots are available (always for v1, whose fixed table is guarded by isFull).
+     */
+    [[maybe_unused]] auto ensureIndexCapacity(std::ofstream &dbStream, std::size_t nNeeded) -> bool
+    {
+        if (containerVersion_ == 1) { return true; }
+
+        auto chainCapacity = std::accumulate(indexBlocks_.begin(),
+            indexBlocks_.end(),
+            std::uint64_t{ 0 },
+            [](std::uint64_t sum, const detail::IndexBlockRef &block) { return sum + block.capacity; });
+        while (entryPtr_.size() + nNeeded > chainCapacity) {
+            dbStream.seekp(0, std::ios::end);
+            const auto blockOffset = static_cast<std::uint64_t>(dbStream.tellp());
+            this->writeIndexBlock(dbStream);
+
+            // Link the new block from its predecessor's next field
+            constexpr auto nextFieldOffset = sizeof(std::uint64_t);
+            dbStream.seekp(static_cast<std::streamoff>(indexBlocks_.back().offset + nextFieldOffset), std::ios::beg);
+            dbStream.write(reinterpret_cast<const char *>(&blockOffset), sizeof(blockOffset));
+            indexBlocks_.emplace_back(blockOffset, detail::gIndexBlockCapacity);
+            chainCapacity += detail::gIndexBlockCapacity;
+        }
+        return !dbStream.bad();
+    }
+
+    /**
+     * @brief Persistent handle used for appends, opened on first use and kept across entries so each commit avoids
+     * an open/close and the metadata churn that causes on network filesystems.
+     * @return Stream opened for in-place binary writing of the database file.
+     */
+    [[nodiscard]] auto writeStream() -> std::ofstream &
+    {
+        if (!writeStream_.is_open()) { writeStream_.open(dbPath_, std::ios::binary | std::ios::ate | std::ios::in); }
+        return writeStream_;
+    }
+
+    /**
+     * @brief Flush pending entries and release the persistent write handle, used before the instance switches to a
+     * different database file.
+     */
+    void closeWriteHandle()
+    {
+        this->flush();
+        writeStream_.close();
+        writeStream_.clear();
+    }
+
+    /**
+     * @brief Append a compressed entry to the pending batch, committing the batch once it reaches the configured
+     * size. With the default batch size of one every entry is committed immediately.
+     * @param rawEntry Compressed entry bytes including the leading codec tag.
+     * @return True if the entry was queued (and, when the batch filled, committed) successfully.
+     */
+    [[maybe_unused]] auto queuePendingEntry(std::vector<char> rawEntry) -> bool
+    {
+        pendingData_.insert(pendingData_.end(), rawEntry.begin(), rawEntry.end());
+        pendingSizes_.emplace_back(rawEntry.size());
+        if (pendingSizes_.size() >= batchSize_) { return this->flush(); }
+        return true;
+    }
+
+    /**
+     * @brief Record one or more entries just written back-to-back at the end of the file: append their offsets to
+     * the lookup table, persist the updated table with the entry count last, refresh the read mapping and extend
+     * the sidecar indices.
+     * @param dbStream Stream the entries were written with.
+     * @param previousEnd File offset the first entry was written at.
+     * @param entrySizes On-disk size of each appended entry in order.
+     * @return True if the lookup table update was written successfully.
+     */
+    [[maybe_unused]] auto commitAppendedEntries(std::ofstream &dbStream,
+        std::streampos previousEnd,
+        std::span<const std::size_t> entrySizes) -> bool
+    {
+        // Calculate the offset of the start of each db entry
+        const std::size_t firstNew = entryPtr_.size();
+        auto entryOffset = static_cast<std::int64_t>(previousEnd);
+        for (const auto entrySize : entrySizes) {
+            entryPtr_.emplace_back(entryOffset);
+            entryOffset += static_cast<std::int64_t>(entrySize);
+        }
+
+        const std::size_t nEntries = entryPtr_.size();
+        constexpr auto elementSize = sizeof(std::ranges::range_value_t<decltype(entryPtr_)>);
+        if (containerVersion_ == 1) {
+            // The fixed LUT is contiguous so all new slots land in a single write
+            dbStream.seekp(firstNew * elementSize + sizeof(std::size_t), std::ios::beg);
+            dbStream.write(reinterpret_cast<const char *>(entryPtr_.data() + firstNew),
+                static_cast<std::streamsize>(entrySizes.size() * elementSize));
+
+            // Write Number of Elements in LUT last to confirm the update
+            dbStream.seekp(0, std::ios::beg);
+            dbStream.write(reinterpret_cast<const char *>(&nEntries), sizeof(nEntries));
+        } else {
+            // New slots may straddle chained blocks, ensureIndexCapacity already extended the chain if needed
+            for (std::size_t entryIdx = firstNew; entryIdx < nEntries; ++entryIdx) {
+                std::size_t slot = entryIdx;
+                auto blockIt = indexBlocks_.begin();
+                while (slot >= blockIt->capacity) {
+                    slot -= blockIt->capacity;
+                    ++blockIt;
+                }
+                dbStream.seekp(
+                    static_cast<std::streamoff>(blockIt->offset + 2 * sizeof(std::uint64_t) + slot * elementSize),
+                    std::ios::beg);
+                dbStream.write(reinterpret_cast<const char *>(&entryPtr_[entryIdx]), elementSize);
+            }
+
+            // Write the entry count last to confirm the update
+            const auto nEntries64 = static_cast<std::uint64_t>(nEntries);
+            dbStream.seekp(sizeof(detail::gContainerMagicV2), std::ios::beg);
+            dbStream.write(reinterpret_cast<const char *>(&nEntries64), sizeof(nEntries64));
+        }
+
+        // Check bad-ness
+        if (dbStream.bad()) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Error Writing Db Offset Entry");
+            return false;
+        }
+
+        // Flush through the persistent handle and refresh the read mapping so the new entries are visible
+        dbStream.flush();
+        this->remapDatabaseFile();
+
+        for (std::size_t entryIdx = firstNew; entryIdx < nEntries; ++entryIdx) {
+            // Append to the UID sidecar index, only the header of the new entry is decompressed
+            if (uidCacheValid_) {
+                uidCache_.emplace_back(this->getEntryUID(entryIdx));
+                std::ofstream uidStream(this->uidCachePath(), std::ios::app);
+                uidStream << uidCache_.back() << '\n';
+            }
+
+            // Append to the header sidecar so metadata scans avoid decompressing entries
+            if (headerCacheValid_) {
+                headerCache_.emplace_back(
+                    this->readFromDatabase(entryIdx, DatabaseInterface<EntryType>::getHeaderImpl));
+                std::ofstream headerStream(this->headerCachePath(), std::ios::binary | std::ios::app);
+                serialize(headerCache_.back(), headerStream);
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Read from database at index using reading function
+     * @tparam Reader invocable that knows how to read data from the decompressed entry stream
      * @param index Index of database to read from
-     * @param reader pointer to function that knows how to read data
-     * @return Struct filled with data read by function pointer if successful, uninitialized if failed ( ͡° ͜ʖ ͡°)
+     * @param reader function that knows how to read data
+     * @return Struct filled with data read by function if successful, uninitialized if failed ( ͡° ͜ʖ ͡°)
      */
-    template<typename T> [[nodiscard]] auto readFromDatabase(std::size_t index, T (*reader)(std::istream &)) const -> T
+    template<std::invocable<std::istream &> Reader>
+    [[nodiscard]] auto readFromDatabase(std::size_t index, Reader &&reader) const
+        -> std::invoke_result_t<Reader, std::istream &>
     {
         namespace bio = boost::iostreams;
-        using clock = std::chrono::high_resolution_clock;
 
         // Check if valid index
         if (index >= entryPtr_.size()) {
             throw std::out_of_range(fmt::format("Index {} exceeds database size {}", index, entryPtr_.size()));
         }
 
-        // Open database and seek to desired position
-        std::ifstream dbStream(dbPath_, std::ios::binary);
-        dbStream.seekg(entryPtr_[index], std::ios::beg);
+        auto entryOffset = static_cast<std::size_t>(entryPtr_[index]);
+
+        // Compressed on-disk span of the entry, the last entry extends to the end of the file
+        const std::uint64_t entryBytes = index + 1 < entryPtr_.size()
+                                             ? static_cast<std::uint64_t>(entryPtr_[index + 1] - entryPtr_[index])
+                                             : (mappedFile_.is_open() ? mappedFile_.size() - entryOffset : 0);
+        perf::ScopedTimer perfTimer(perf::Stage::DbRead, entryBytes);
 
         bio::filtering_istream filterStream{};
-        filterStream.push(bio::zlib_decompressor());
-        filterStream.push(dbStream);
+
+        // Prefer the zero-copy path, decompressing directly from the mapped region. Fall back to opening and
+        // seeking an ifstream if the mapping is unavailable (or stale from a concurrent writer).
+        std::ifstream dbStream;
+        if (mappedFile_.is_open() && entryOffset < mappedFile_.size()) {
+            const auto [codec, isTagged] =
+                detail::codecFromFirstByte(static_cast<std::uint8_t>(mappedFile_.data()[entryOffset]));
+            if (isTagged) { ++entryOffset; }
+            detail::pushDecompressor(filterStream, codec);
+            filterStream.push(bio::array_source(mappedFile_.data() + entryOffset, mappedFile_.size() - entryOffset));
+        } else {
+            dbStream.open(dbPath_, std::ios::binary);
+            dbStream.seekg(static_cast<std::streamoff>(entryOffset), std::ios::beg);
+            const auto [codec, isTagged] = detail::codecFromFirstByte(static_cast<std::uint8_t>(dbStream.peek()));
+            if (isTagged) { dbStream.get(); }
+            detail::pushDecompressor(filterStream, codec);
+            filterStream.push(dbStream);
+        }
 
         // Load and return the data
-        // auto start = clock::now();
-        T data;
-        // const std::streampos pos_start = dbStream.tellg();
+        std::invoke_result_t<Reader, std::istream &> data;
         try {
             data = reader(filterStream);
         } catch (const std::bad_alloc &e) {
@@ -391,10 +1142,6 @@ template<HasDBInterface EntryType> class ReplayDatabase
                 gLoggerDB, "Failed to read from {} at index {}, got error: {}", dbPath_.string(), index, e.what());
             throw e;
         }
-        // const std::streampos pos_end = dbStream.tellg();
-        // spdlog::debug("Took {} to load {} bytes",
-        //     std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start),
-        //     pos_end - pos_start);
         filterStream.reset();
         return data;
     }
@@ -408,6 +1155,332 @@ template<HasDBInterface EntryType> class ReplayDatabase
      * @brief Look up table for database entries
      */
     std::vector<std::int64_t> entryPtr_{};
+
+    /**
+     * @brief On-disk container version of the open database: v1 has a fixed preallocated lookup table, v2 chains
+     * growable index blocks. New databases are created as v2, v1 files remain readable and appendable.
+     */
+    std::uint32_t containerVersion_{ 2 };
+
+    /**
+     * @brief Index block chain of a v2 container in file order, empty for v1 databases.
+     */
+    std::vector<detail::IndexBlockRef> indexBlocks_{};
+
+    /**
+     * @brief Read-only memory mapping of the database file, opened once on open()/load() and refreshed after each
+     * addEntry so reads avoid per-entry open/seek/read syscall churn.
+     */
+    boost::iostreams::mapped_file_source mappedFile_{};
+
+    /**
+     * @brief Persistent append handle, opened lazily by writeStream() and kept across commits.
+     */
+    std::ofstream writeStream_{};
+
+    /**
+     * @brief Number of entries accumulated in memory before a single-write commit, one commits immediately.
+     */
+    std::size_t batchSize_{ 1 };
+
+    /**
+     * @brief Compressed bytes of entries awaiting commit, stored back-to-back in append order.
+     */
+    std::vector<char> pendingData_{};
+
+    /**
+     * @brief On-disk size of each pending entry in pendingData_.
+     */
+    std::vector<std::size_t> pendingSizes_{};
+
+    /**
+     * @brief Codec used to compress new entries. Defaults to zlib for compatibility with existing tooling.
+     */
+    Codec writeCodec_{ Codec::Zlib };
+
+    /**
+     * @brief Optional process-shared cache of decoded entries, consulted and populated by getEntry when attached.
+     */
+    std::shared_ptr<SharedReplayCache> entryCache_{};
+
+    /**
+     * @brief In-memory copy of the UID sidecar index, one UID per entry in database order. Mutable so a missing or
+     * stale index can be rebuilt (and persisted) from const accessors.
+     */
+    mutable std::vector<std::string> uidCache_{};
+
+    /**
+     * @brief Whether uidCache_ is consistent with the entry table.
+     */
+    mutable bool uidCacheValid_{ false };
+
+    /**
+     * @brief In-memory copy of the header sidecar, one header per entry in database order.
+     */
+    mutable std::vector<header_type> headerCache_{};
+
+    /**
+     * @brief Whether headerCache_ is consistent with the entry table.
+     */
+    mutable bool headerCacheValid_{ false };
+};
+
+/**
+ * @brief Read-only view over a directory of .SC2Replays shards presented as one contiguous database. A global index
+ * maps flat dataset indices to (shard, local index) and is persisted next to the shards, so reopening a dataset of
+ * hundreds of shards does not reopen every file. Shard handles are created lazily and at most maxOpenShards are
+ * kept open with LRU eviction. This provides merged-dataset random access without an sc2_merger pass.
+ * @tparam EntryType Type of database entry the shards hold
+ */
+template<HasDBInterface EntryType> class ShardedReplayDatabase
+{
+  public:
+    /**
+     * @brief Metadata type of a database entry
+     */
+    using header_type = typename DatabaseInterface<EntryType>::header_type;
+
+    /**
+     * @brief Maximum number of shard handles (and their memory mappings) kept open at once.
+     */
+    static constexpr std::size_t maxOpenShards = 16;
+
+    /**
+     * @brief Create an empty sharded database with no associated directory
+     */
+    ShardedReplayDatabase() = default;
+
+    /**
+     * @brief Open all shards in a directory as one dataset
+     * @param folder Directory containing .SC2Replays shard files
+     */
+    explicit ShardedReplayDatabase(const std::filesystem::path &folder) { this->open(folder); }
+
+    /**
+     * @brief Open every .SC2Replays shard in a directory as one flat dataset. The persisted global index is used
+     * when it still matches the shards on disk, otherwise each shard is opened once to rebuild and persist it.
+     * @param folder Directory containing the shard files
+     * @return True if at least one shard was found and indexed, false otherwise
+     */
+    [[maybe_unused]] auto open(const std::filesystem::path &folder) -> bool
+    {
+        namespace fs = std::filesystem;
+        if (!fs::is_directory(folder)) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Shard directory does not exist: {}", folder.string());
+            return false;
+        }
+        folder_ = folder;
+        shardPaths_.clear();
+        for (auto &&dirEntry : fs::directory_iterator{ folder_ }) {
+            if (dirEntry.path().extension() == ".SC2Replays") { shardPaths_.emplace_back(dirEntry.path()); }
+        }
+        // Directory iteration order is unspecified, sort so flat indices are deterministic across runs
+        std::ranges::sort(shardPaths_);
+        if (shardPaths_.empty()) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "No .SC2Replays shards found in {}", folder_.string());
+            return false;
+        }
+        shards_.assign(shardPaths_.size(), nullptr);
+        openOrder_.clear();
+        if (!this->loadShardIndex()) { this->rebuildShardIndex(); }
+        return true;
+    }
+
+    /**
+     * @brief Total number of entries over all shards
+     * @return Number of entries in the sharded database
+     */
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return cumulativeEntries_.empty() ? 0 : cumulativeEntries_.back();
+    }
+
+    /**
+     * @brief Number of shard files in the dataset
+     * @return Number of shards
+     */
+    [[nodiscard]] auto numShards() const noexcept -> std::size_t { return shardPaths_.size(); }
+
+    /**
+     * @brief Get the directory of the sharded database
+     * @return path to the shard directory
+     */
+    [[nodiscard]] auto path() const noexcept -> const std::filesystem::path & { return folder_; }
+
+    /**
+     * @brief Map a flat dataset index to the owning shard and the index within that shard.
+     * @param index Flat index into the sharded database
+     * @return Pair of shard index and entry index local to that shard
+     */
+    [[nodiscard]] auto toShardIndex(std::size_t index) const -> std::pair<std::size_t, std::size_t>
+    {
+        if (index >= this->size()) {
+            throw std::out_of_range(fmt::format("Index {} exceeds sharded database size {}", index, this->size()));
+        }
+        const auto shardIt = std::ranges::upper_bound(cumulativeEntries_, index);
+        const auto shardIdx = static_cast<std::size_t>(std::distance(cumulativeEntries_.begin(), shardIt));
+        const std::size_t priorEntries = shardIdx == 0 ? 0 : cumulativeEntries_[shardIdx - 1];
+        return { shardIdx, index - priorEntries };
+    }
+
+    /**
+     * @brief Retrieves an entry by flat index from the owning shard.
+     * @param index Flat index of the data to retrieve
+     * @return The retrieved entry
+     */
+    [[nodiscard]] auto getEntry(std::size_t index) const -> EntryType
+    {
+        const auto [shardIdx, localIdx] = this->toShardIndex(index);
+        return this->getShard(shardIdx)->getEntry(localIdx);
+    }
+
+    /**
+     * @brief Retrieves replay header information by flat index from the owning shard.
+     * @param index Flat index to read from the database
+     * @return ReplayInfo at index
+     */
+    [[nodiscard]] auto getHeader(std::size_t index) const -> header_type
+    {
+        const auto [shardIdx, localIdx] = this->toShardIndex(index);
+        return this->getShard(shardIdx)->getHeader(localIdx);
+    }
+
+    /**
+     * @brief Retrieves the UID of an entry by flat index from the owning shard.
+     * @param index Flat index of the data to retrieve
+     * @return A pair containing the replay hash and player id
+     */
+    [[nodiscard]] auto getEntryUID(std::size_t index) const -> std::string
+    {
+        const auto [shardIdx, localIdx] = this->toShardIndex(index);
+        return this->getShard(shardIdx)->getEntryUID(localIdx);
+    }
+
+    /**
+     * @brief Handle to a shard, opened on demand. The least recently used handle is closed once more than
+     * maxOpenShards are open; in-flight readers of an evicted shard keep it alive through their shared_ptr.
+     * @param shardIdx Index of the shard to open
+     * @return Shared handle to the shard's database
+     */
+    [[nodiscard]] auto getShard(std::size_t shardIdx) const -> std::shared_ptr<const ReplayDatabase<EntryType>>
+    {
+        std::scoped_lock lock(shardMutex_);
+        auto &shard = shards_.at(shardIdx);
+        if (shard == nullptr) {
+            shard = std::make_shared<ReplayDatabase<EntryType>>();
+            if (!shard->load(shardPaths_[shardIdx])) {
+                shard.reset();
+                throw std::runtime_error(fmt::format("Failed to load shard {}", shardPaths_[shardIdx].string()));
+            }
+        }
+        std::erase(openOrder_, shardIdx);
+        openOrder_.emplace_back(shardIdx);
+        if (openOrder_.size() > maxOpenShards) {
+            shards_[openOrder_.front()].reset();
+            openOrder_.erase(openOrder_.begin());
+        }
+        return shard;
+    }
+
+    /**
+     * @brief Path to the persisted global index that accompanies the shard directory
+     * @return Shard directory with "shards.sidx" appended
+     */
+    [[nodiscard]] auto shardIndexPath() const -> std::filesystem::path { return folder_ / "shards.sidx"; }
+
+  private:
+    /**
+     * @brief Load the persisted global index. Each line records a shard's entry count, on-disk size and filename;
+     * the index is only accepted if it covers exactly the discovered shards with matching file sizes.
+     * @return True if the index was loaded and is consistent with the shards on disk
+     */
+    [[nodiscard]] auto loadShardIndex() -> bool
+    {
+        namespace fs = std::filesystem;
+        cumulativeEntries_.clear();
+        const auto indexPath = this->shardIndexPath();
+        if (!fs::exists(indexPath)) { return false; }
+
+        // filename -> (nEntries, file size at index build time)
+        std::unordered_map<std::string, std::pair<std::size_t, std::size_t>> recorded;
+        std::ifstream indexStream(indexPath);
+        std::string line;
+        while (std::getline(indexStream, line)) {
+            std::istringstream lineStream(line);
+            std::size_t nEntries{};
+            std::size_t fileSize{};
+            std::string filename;
+            lineStream >> nEntries >> fileSize;
+            lineStream.ignore(1);
+            std::getline(lineStream, filename);
+            if (lineStream.fail() || filename.empty()) { return false; }
+            recorded.emplace(std::move(filename), std::pair{ nEntries, fileSize });
+        }
+        if (recorded.size() != shardPaths_.size()) { return false; }
+
+        std::size_t total = 0;
+        for (auto &&shardPath : shardPaths_) {
+            const auto recordedShard = recorded.find(shardPath.filename().string());
+            if (recordedShard == recorded.end() || recordedShard->second.second != fs::file_size(shardPath)) {
+                SPDLOG_LOGGER_WARN(gLoggerDB, "Shard index {} is stale, rebuilding", indexPath.string());
+                cumulativeEntries_.clear();
+                return false;
+            }
+            total += recordedShard->second.first;
+            cumulativeEntries_.emplace_back(total);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Build the global index by opening each shard once, then persist it next to the shards.
+     */
+    void rebuildShardIndex()
+    {
+        SPDLOG_LOGGER_INFO(
+            gLoggerDB, "Building shard index over {} shards in {}", shardPaths_.size(), folder_.string());
+        cumulativeEntries_.clear();
+        std::size_t total = 0;
+        std::ofstream indexStream(this->shardIndexPath(), std::ios::trunc);
+        for (std::size_t shardIdx = 0; shardIdx < shardPaths_.size(); ++shardIdx) {
+            const auto shard = this->getShard(shardIdx);
+            total += shard->size();
+            cumulativeEntries_.emplace_back(total);
+            indexStream << shard->size() << ' ' << std::filesystem::file_size(shardPaths_[shardIdx]) << ' '
+                        << shardPaths_[shardIdx].filename().string() << '\n';
+        }
+    }
+
+    /**
+     * @brief Directory containing the shard files
+     */
+    std::filesystem::path folder_{ "" };
+
+    /**
+     * @brief Paths of the discovered shards, sorted by filename so flat indices are stable
+     */
+    std::vector<std::filesystem::path> shardPaths_{};
+
+    /**
+     * @brief Running total of entries up to and including each shard, searched to resolve flat indices
+     */
+    std::vector<std::size_t> cumulativeEntries_{};
+
+    /**
+     * @brief Lazily opened shard handles, slots of closed shards hold nullptr. Mutable so the const read accessors
+     * can open shards on demand.
+     */
+    mutable std::vector<std::shared_ptr<ReplayDatabase<EntryType>>> shards_{};
+
+    /**
+     * @brief Open shards from least to most recently used, bounded by maxOpenShards
+     */
+    mutable std::vector<std::size_t> openOrder_{};
+
+    /**
+     * @brief Guards shards_ and openOrder_ so concurrent readers share one handle cache
+     */
+    mutable std::mutex shardMutex_{};
 };
 
 
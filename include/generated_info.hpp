@@ -433,5 +433,38 @@ const static std::unordered_map<std::string, std::unordered_map<Race, std::unord
     },
 };
 
+// Research delay (game steps) of each upgrade ability id by game version
+const static std::unordered_map<std::string, std::unordered_map<int, int>> upgradeDelays = {
+    {"4.8.2.71663", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.8.4.73286", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.8.6.73620", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.9.1.74456", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.9.2.74741", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.9.3.75025", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.7.1.70326", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.4.0.65895", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.2.0.62347", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.1.4.61545", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,0}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.3.2.65384", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.6.2.69232", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.6.1.68195", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,960}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2560}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2720}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.8.3.72282", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2720}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2560}, {1063,3040}, {1064,3520}, {1065,2560}, {1066,3040}, {1067,3520}, {1068,2560}, {1069,3040}, {1070,3520}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2560}, {1563,3040}, {1564,3520}, {1565,2560}, {1566,3040}, {1567,3520}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.10.4.76811", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"4.10.2.76052", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,1280}, {805,1760}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,1760}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1482,1760}, {1532,2240}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1200} }},
+    {"5.0.5.82893", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.4.82457", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"4.11.4.78285", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.7.84643", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.8.86383", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.6.83830", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.9.87702", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.2.81433", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"4.12.0.80188", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.10.88500", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.10.89165", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2720}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {821,1280}, {822,1760}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2880}, {1063,3440}, {1064,4000}, {1065,2880}, {1066,3440}, {1067,4000}, {1068,2880}, {1069,3440}, {1070,4000}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.11.89720", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2240}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2720}, {1063,3240}, {1064,3760}, {1065,2720}, {1066,3240}, {1067,3760}, {1068,2720}, {1069,3240}, {1070,3760}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+    {"5.0.11.90136", { {44,0}, {45,1280}, {46,1440}, {47,1760}, {48,1280}, {49,2240}, {216,1760}, {217,1760}, {218,2080}, {263,960}, {265,1760}, {650,1280}, {651,2240}, {652,2560}, {653,3040}, {654,3520}, {655,1760}, {656,2560}, {657,3040}, {658,3520}, {683,1600}, {730,2240}, {731,1760}, {732,960}, {761,1760}, {763,1760}, {764,1760}, {765,1760}, {766,1760}, {767,1760}, {768,1760}, {769,2240}, {790,1760}, {792,1280}, {793,1760}, {796,1760}, {797,1760}, {799,2240}, {800,1760}, {802,1920}, {803,1760}, {804,0}, {805,0}, {806,1760}, {820,1920}, {852,2560}, {853,3040}, {854,3520}, {855,2560}, {856,3040}, {857,3520}, {858,2560}, {859,3040}, {860,3520}, {861,2560}, {862,3040}, {863,3520}, {864,0}, {865,0}, {866,0}, {1062,2720}, {1063,3240}, {1064,3760}, {1065,2720}, {1066,3240}, {1067,3760}, {1068,2720}, {1069,3240}, {1070,3760}, {1093,1280}, {1094,1280}, {1097,2240}, {1099,1280}, {1126,1760}, {1186,2560}, {1187,3040}, {1188,3520}, {1189,2560}, {1190,3040}, {1191,3520}, {1192,2560}, {1193,3040}, {1194,3520}, {1195,1280}, {1223,960}, {1224,2080}, {1225,1600}, {1252,2080}, {1253,1760}, {1282,1600}, {1283,1600}, {1286,0}, {1312,2560}, {1313,3040}, {1314,3520}, {1315,2560}, {1316,3040}, {1317,3520}, {1454,1280}, {1455,1760}, {1456,1920}, {1457,1760}, {1482,1760}, {1532,2240}, {1533,1760}, {1534,1280}, {1562,2880}, {1563,3440}, {1564,4000}, {1565,2880}, {1566,3440}, {1567,4000}, {1568,2240}, {1571,1280}, {1592,2240}, {1593,2720}, {1594,2240}, {1595,2240}, {1596,2240}, {1597,2240}, {2294,2560}, {2295,3040}, {2296,3520}, {2297,2560}, {2298,3040}, {2299,3520}, {2720,2240}, {3121,0}, {3122,0}, {3123,0}, {3124,0}, {3125,0}, {3692,0}, {3693,0}, {3694,0}, {3695,0}, {3696,0}, {3697,0}, {3698,0}, {3699,0}, {3700,0}, {3701,0}, {3702,0}, {3703,0}, {3704,0}, {3705,0}, {3706,0}, {3709,1280}, {3710,1280} }},
+};
+
 // clang-format on
 }// namespace cvt
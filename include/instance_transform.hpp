@@ -14,7 +14,10 @@
 #include "soa.hpp"
 
 #include <algorithm>
+#include <execution>
+#include <numeric>
 #include <ranges>
+#include <thread>
 
 namespace cvt {
 
@@ -177,6 +180,76 @@ template<IsSoAType SoA, typename Comp>
     return result;
 }
 
+/**
+ * @brief Parallel version of flattenAndSortData2. Rather than materialising a flat array of (step, element) pairs and
+ * stable-sorting it, this sorts an index permutation over the original time-major data with a key extractor (ties
+ * broken by flat index, preserving time order within an instance) and gathers directly into the destination SoA. This
+ * avoids the intermediate pair copies entirely and uses all cores for the sort.
+ *
+ * @tparam SoA type
+ * @tparam KeyFn key extractor invoked with const SoA::struct_type&, elements are ordered by the returned key
+ * @param stepData Data grouped by time to rearrange
+ * @param key Sorting key extractor, e.g. the unit id
+ * @return FlattenedData2<SoA> identical to the flattenAndSortData2 result for an equivalent comparator
+ */
+template<IsSoAType SoA, typename KeyFn>
+    requires std::invocable<KeyFn, const typename SoA::struct_type &>
+[[nodiscard]] auto flattenAndSortDataPar(const std::vector<std::vector<typename SoA::struct_type>> &stepData,
+    KeyFn &&key) noexcept -> FlattenedData2<SoA>
+{
+    using S = SoA::struct_type;
+
+    // Exclusive prefix sum of element counts to map flat index -> (step, offset-in-step)
+    std::vector<std::size_t> stepBegin(stepData.size() + 1, 0);
+    for (std::size_t idx = 0; idx < stepData.size(); ++idx) { stepBegin[idx + 1] = stepBegin[idx] + stepData[idx].size(); }
+    const std::size_t nElem = stepBegin.back();
+
+    std::vector<std::uint32_t> stepOf(nElem);
+    for (std::size_t idx = 0; idx < stepData.size(); ++idx) {
+        std::fill(stepOf.begin() + static_cast<std::ptrdiff_t>(stepBegin[idx]),
+            stepOf.begin() + static_cast<std::ptrdiff_t>(stepBegin[idx + 1]),
+            static_cast<std::uint32_t>(idx));
+    }
+
+    const auto elemAt = [&](std::size_t flatIdx) -> const S & {
+        const auto step = stepOf[flatIdx];
+        return stepData[step][flatIdx - stepBegin[step]];
+    };
+
+    // Significantly better compressibility when sorted by instance (and implicitly time)
+    std::vector<std::uint32_t> perm(nElem);
+    std::iota(perm.begin(), perm.end(), 0u);
+    std::sort(std::execution::par_unseq, perm.begin(), perm.end(), [&](std::uint32_t a, std::uint32_t b) {
+        const auto keyA = key(elemAt(a));
+        const auto keyB = key(elemAt(b));
+        if (keyA != keyB) { return keyA < keyB; }
+        return a < b;// Equal keys keep time-major order, matching stable_sort
+    });
+
+    // Gather directly into the flattened SoA
+    FlattenedData2<SoA> result;
+    result.max_step = static_cast<std::uint32_t>(stepData.size());
+    boost::pfr::for_each_field(result.data, [&](auto &field) { field.reserve(nElem); });
+    for (auto &&flatIdx : perm) { detail::emplaceBackIntoSoA(result.data, elemAt(flatIdx)); }
+    if (nElem == 0) { return result; }
+
+    // Chunk the time indices into iota-ranges, same encoding as flattenAndSortData2
+    std::uint32_t chunkStart = stepOf[perm.front()];
+    std::uint32_t chunkNum = 1;
+    for (std::size_t idx = 1; idx < nElem; ++idx) {
+        if (stepOf[perm[idx]] == stepOf[perm[idx - 1]] + 1) {
+            ++chunkNum;
+        } else {
+            result.step_count.emplace_back(chunkStart, chunkNum);
+            chunkStart = stepOf[perm[idx]];
+            chunkNum = 1;
+        }
+    }
+    result.step_count.emplace_back(chunkStart, chunkNum);
+
+    return result;
+}
+
 /**
  * @brief Transform v2 instance-major unit data back to time-major
  * @tparam SoA struct-of-array type
@@ -206,4 +279,93 @@ template<IsSoAType SoA>
     return stepData;
 }
 
+/**
+ * @brief Parallel version of recoverFlattenedSortedData2. Two passes: first histogram the iota-ranges to
+ * exact-reserve each per-step vector (the serial version grows them incrementally), then scatter elements over
+ * disjoint step ranges in parallel, each worker walking the iota-ranges in flat order so per-step element order
+ * matches the serial result. Worker step boundaries are balanced by element count from the histogram prefix.
+ * @tparam SoA struct-of-array type
+ * @param flatStepData sorted flat data to transform back to time-major
+ * @return Unit data grouped by time, identical to the recoverFlattenedSortedData2 result
+ */
+template<IsSoAType SoA>
+[[nodiscard]] auto recoverFlattenedSortedData2Par(
+    const FlattenedData2<SoA> &flatStepData) noexcept -> std::vector<std::vector<typename SoA::struct_type>>
+{
+    const std::size_t nWorkers = std::max(1u, std::thread::hardware_concurrency());
+    if (nWorkers < 2 || flatStepData.size() == 0) { return recoverFlattenedSortedData2(flatStepData); }
+
+    // Pass 1: histogram per-step element counts from the iota-ranges, then prefix-sum for load balancing
+    std::vector<std::size_t> stepCount(flatStepData.max_step + 1ull, 0);
+    for (auto &&iota : flatStepData.step_count) {
+        for (std::uint32_t step = iota.start; step < iota.start + iota.num; ++step) { ++stepCount[step + 1ull]; }
+    }
+    std::inclusive_scan(stepCount.begin(), stepCount.end(), stepCount.begin());
+
+    std::vector<std::vector<typename SoA::struct_type>> stepData(flatStepData.max_step);
+    for (std::size_t step = 0; step < stepData.size(); ++step) {
+        stepData[step].reserve(stepCount[step + 1] - stepCount[step]);
+    }
+
+    // Balance worker step boundaries so each contiguous step range holds roughly equal elements
+    std::vector<std::uint32_t> bounds(nWorkers + 1, flatStepData.max_step);
+    for (std::size_t w = 0; w < nWorkers; ++w) {
+        const std::size_t target = w * flatStepData.size() / nWorkers;
+        const auto boundary = std::ranges::lower_bound(stepCount, target);
+        bounds[w] = static_cast<std::uint32_t>(std::distance(stepCount.begin(), boundary));
+    }
+
+    // Pass 2: scatter elements to the step vectors, each worker owns the steps in [bounds[w], bounds[w + 1])
+    const auto workerIds = std::views::iota(std::size_t{ 0 }, nWorkers);
+    std::for_each(std::execution::par, workerIds.begin(), workerIds.end(), [&](std::size_t w) {
+        const auto lo = bounds[w];
+        const auto hi = bounds[w + 1];
+        if (lo >= hi) { return; }
+        std::size_t base = 0;
+        for (auto &&iota : flatStepData.step_count) {
+            const auto first = std::max(iota.start, lo);
+            const auto last = std::min(iota.start + iota.num, hi);
+            for (std::uint32_t step = first; step < last; ++step) {
+                stepData[step].emplace_back(flatStepData.data[base + step - iota.start]);
+            }
+            base += iota.num;
+        }
+    });
+    return stepData;
+}
+
+/**
+ * @brief Transform a [start, start + count) step window of v2 instance-major unit data back to time-major. Only the
+ * window steps are materialized, instances outside it are skipped during the scan.
+ * @tparam SoA struct-of-array type
+ * @param flatStepData sorted flat data to transform back to time-major
+ * @param start first step of the window
+ * @param count number of steps in the window
+ * @return Unit data grouped by time for the window steps, indexed relative to start
+ */
+template<IsSoAType SoA>
+[[nodiscard]] auto recoverFlattenedSortedData2Window(const FlattenedData2<SoA> &flatStepData,
+    std::uint32_t start,
+    std::uint32_t count) noexcept -> std::vector<std::vector<typename SoA::struct_type>>
+{
+    const auto end = std::min<std::uint32_t>(flatStepData.max_step, start + count);
+    std::vector<std::vector<typename SoA::struct_type>> stepData(end > start ? end - start : 0);
+
+    // Copy window data to correct outer index
+    std::uint32_t offset = 0;
+    auto step_count = flatStepData.step_count.begin();
+    for (std::size_t idx : std::ranges::iota_view{ 0UL, flatStepData.size() }) {
+        const auto step = step_count->start + offset;
+        if (step >= start && step < end) { stepData[step - start].emplace_back(flatStepData.data[idx]); }
+        // Increment the base and reset the offset if there is a new unit next
+        if (offset < step_count->num - 1) {
+            offset++;
+        } else {
+            step_count++;
+            offset = 0;
+        }
+    }
+    return stepData;
+}
+
 }// namespace cvt
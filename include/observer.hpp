@@ -18,9 +18,17 @@
 #include "database.hpp"
 #include "generated_info.hpp"
 
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace cvt {
 
@@ -45,6 +53,36 @@ struct ResourceObs
     int qty;
 };
 
+/**
+ * @brief Output database and known-hash registry shared between converter instances writing to the same target.
+ * A converter owns a private instance by default so the single-instance setup is unchanged; parallel conversion
+ * attaches every worker to one shared state so database writes are serialized through one handle and completed
+ * replays are skipped across all workers.
+ * @tparam DataSoA observation data structure being serialized
+ */
+template<typename DataSoA> struct ConverterSharedState
+{
+    /**
+     * @brief Output database, writes must hold dbMutex.
+     */
+    ReplayDatabase<DataSoA> database{};
+
+    /**
+     * @brief Serializes database writes from concurrent converter writer threads.
+     */
+    std::mutex dbMutex{};
+
+    /**
+     * @brief UIDs already present in the database plus hashes registered as bad, guarded by hashMutex.
+     */
+    std::unordered_set<std::string> knownHashes{};
+
+    /**
+     * @brief Guards knownHashes.
+     */
+    mutable std::mutex hashMutex{};
+};
+
 /**
  * @brief Base replay observer and converter that implements functions common to all the other sampling variants.
  * @tparam DataSoA observation data structure to be observed and serialized
@@ -52,6 +90,28 @@ struct ResourceObs
 template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
 {
   public:
+    /**
+     * @brief Maximum number of completed replays buffered for the background writer before OnGameEnd blocks.
+     */
+    static constexpr std::size_t maxQueuedWrites = 2;
+
+    /**
+     * @brief Maximum number of recycled step buffers retained in stepPool_.
+     */
+    static constexpr std::size_t maxPooledSteps = 1 << 16;
+
+    /**
+     * @brief Wait for any queued replays to be compressed and written, then stop the writer thread.
+     */
+    ~BaseConverter() override
+    {
+        if (writerThread_.joinable()) {
+            this->flushWrites();
+            writerThread_.request_stop();
+            writeCondVar_.notify_all();
+        }
+    }
+
     /**
      * @brief Loads the database from the specified path.
      * @param path The path to the database file.
@@ -59,11 +119,19 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
      */
     auto loadDB(const std::filesystem::path &path) -> bool
     {
-        auto result = database_.open(path);
-        if (result) { knownHashes_ = database_.getAllUIDs(); }
+        std::scoped_lock lock(shared_->dbMutex, shared_->hashMutex);
+        auto result = shared_->database.open(path);
+        if (result) { shared_->knownHashes = shared_->database.getAllUIDs(); }
         return result;
     }
 
+    /**
+     * @brief Attach this converter to a database/known-hash state shared with other converter instances. Call before
+     * loadDB, which then opens the database once for all attached converters.
+     * @param shared Shared state to attach to.
+     */
+    void setSharedState(std::shared_ptr<ConverterSharedState<DataSoA>> shared) noexcept { shared_ = std::move(shared); }
+
     /**
      * @brief Sets the replay information for the BaseConverter.
      * @param hash The hash of the replay.
@@ -102,14 +170,19 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
      */
     [[nodiscard]] auto isKnownHash(const std::string &hash) const noexcept -> bool
     {
-        return knownHashes_.contains(hash);
+        std::scoped_lock lock(shared_->hashMutex);
+        return shared_->knownHashes.contains(hash);
     }
 
     /**
      * @brief Adds a known hash to the BaseConverter's list of known hashes.
      * @param hash The hash to be added.
      */
-    void addKnownHash(std::string_view hash) noexcept { knownHashes_.emplace(hash); }
+    void addKnownHash(std::string_view hash) noexcept
+    {
+        std::scoped_lock lock(shared_->hashMutex);
+        shared_->knownHashes.emplace(hash);
+    }
 
     /**
      * @brief Clears the BaseConverter object. This function clears the internal state of the BaseConverter object. It
@@ -121,7 +194,114 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
      */
     void clear() noexcept;
 
+    /**
+     * @brief Block until all queued replays have been compressed and written to the database.
+     */
+    void flushWrites()
+    {
+        if (!writerThread_.joinable()) { return; }
+        std::unique_lock lock(writeMutex_);
+        writeCondVar_.wait(lock, [this] { return pendingWrites_ == 0; });
+    }
+
+    /**
+     * @brief Check if any background write has failed since the converter was created.
+     * @return True if a queued replay failed to be written to the database.
+     */
+    [[nodiscard]] auto hasWriteFailure() const noexcept -> bool { return writeFailure_; }
+
   protected:
+    /**
+     * @brief Hand a completed replay to the background writer thread which performs the SoA conversion, compression
+     * and database write. Blocks if maxQueuedWrites replays are already buffered.
+     * @param replay Completed replay data to write, consumed by the writer.
+     */
+    void enqueueWrite(typename DataSoA::struct_type &&replay)
+    {
+        if (!writerThread_.joinable()) {
+            writerThread_ = std::jthread([this](std::stop_token stopToken) { this->writerLoop(stopToken); });
+        }
+        {
+            std::unique_lock lock(writeMutex_);
+            writeCondVar_.wait(lock, [this] { return writeQueue_.size() < maxQueuedWrites; });
+            writeQueue_.emplace_back(std::move(replay));
+            ++pendingWrites_;
+        }
+        writeCondVar_.notify_all();
+    }
+
+    /**
+     * @brief Writer thread main loop, consumes the write queue until stopped and drained.
+     * @param stopToken Token signalling the converter is being destroyed.
+     */
+    void writerLoop(std::stop_token stopToken)
+    {
+        while (true) {
+            std::unique_lock lock(writeMutex_);
+            writeCondVar_.wait(lock, stopToken, [this] { return !writeQueue_.empty(); });
+            if (writeQueue_.empty()) { return; }// Stop requested and queue drained
+            auto replay = std::move(writeQueue_.front());
+            writeQueue_.pop_front();
+            lock.unlock();
+            writeCondVar_.notify_all();
+
+            // Conversion happens outside the database lock so only the final write is serialized between workers
+            const auto entry = AoStoSoA<DataSoA, typename DataSoA::struct_type>(replay);
+            const bool ok = [&] {
+                std::scoped_lock dbLock(shared_->dbMutex);
+                return shared_->database.addEntry(entry);
+            }();
+            if (ok) {
+                SPDLOG_INFO("Saved Replay: {}, PlayerID: {}", replay.getReplayHash(), replay.getPlayerId());
+            } else {
+                SPDLOG_ERROR("Background write failed for replay {}", replay.getReplayHash());
+                writeFailure_ = true;
+            }
+            this->recycleSteps(std::move(replay.data));
+
+            {
+                std::scoped_lock countLock(writeMutex_);
+                --pendingWrites_;
+            }
+            writeCondVar_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Append the next step buffer to replayData_.data, recycling a pooled step from a previously written
+     * replay when one is available. Nested containers of a recycled step are cleared but keep their allocated
+     * capacity, so recording a step of the same map size performs no minimap or unit-vector heap allocation.
+     */
+    void advanceStep() noexcept
+    {
+        {
+            std::scoped_lock lock(stepPoolMutex_);
+            if (!stepPool_.empty()) {
+                auto &step = replayData_.data.emplace_back(std::move(stepPool_.back()));
+                stepPool_.pop_back();
+                boost::pfr::for_each_field(step, [](auto &field) {
+                    if constexpr (requires { field.clear(); }) { field.clear(); }
+                });
+                return;
+            }
+        }
+        replayData_.data.emplace_back();
+    }
+
+    /**
+     * @brief Return drained step buffers from a written replay to the pool so subsequent recording reuses their
+     * allocations, bounded by maxPooledSteps. Called by the writer thread once the replay has been converted.
+     * @param steps Steps to recycle, consumed.
+     */
+    void recycleSteps(std::vector<typename DataSoA::struct_type::step_type> &&steps) noexcept
+    {
+        std::scoped_lock lock(stepPoolMutex_);
+        for (auto &step : steps) {
+            if (stepPool_.size() >= maxPooledSteps) { break; }
+            stepPool_.emplace_back(std::move(step));
+        }
+    }
+
     /**
      * @brief Copies the height map data for the match.
      */
@@ -147,6 +327,18 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
      */
     void copyCommonData() noexcept;
 
+    /**
+     * @brief Hashable key of a resource's x,y map position. Resources never move in x,y but may drift a little in z,
+     * so z is excluded. The exact float bit patterns are packed, matching the equality comparison this replaces.
+     * @param pos Position of the resource.
+     * @return Key for resourcePosIndex_.
+     */
+    [[nodiscard]] static auto resourcePositionKey(const Point3f &pos) noexcept -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(pos.x)) << 32
+               | std::bit_cast<std::uint32_t>(pos.y);
+    }
+
     /**
      * @brief Reassigns the resource ID for a given NeutralUnit when it changes visibility. It gets reassociated with an
      * old id based on locality.
@@ -157,17 +349,16 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
     {
         // Check if there's an existing unit with the same x,y coordinate
         // (may move a little bit in z, but its fundamentally the same unit)
-        auto oldKV = std::ranges::find_if(resourceObs_, [=](auto &&keyValue) {
-            const auto &value = keyValue.second;
-            return value.pos.x == unit.pos.x && value.pos.y == unit.pos.y;
-        });
-        if (oldKV == resourceObs_.end()) {
+        auto posEntry = resourcePosIndex_.find(resourcePositionKey(unit.pos));
+        if (posEntry == resourcePosIndex_.end()) {
             SPDLOG_WARN(
                 "No matching position for unit {} (id: {}) adding new", sc2::UnitTypeToName(unit.unitType), unit.id);
             return false;
         } else {
+            auto oldKV = resourceObs_.find(posEntry->second);
             resourceObs_.emplace(unit.id, std::move(oldKV->second));
-            resourceObs_.erase(oldKV->first);
+            resourceObs_.erase(oldKV);
+            posEntry->second = unit.id;
             return true;
         }
     }
@@ -183,6 +374,7 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
             // Skip Not a mineral/gas resource
             if (!defaultResources.contains(unit.unitType)) { continue; }
             resourceObs_.emplace(unit.id, ResourceObs{ unit.id, unit.pos, defaultResources.at(unit.unitType) });
+            resourcePosIndex_.emplace(resourcePositionKey(unit.pos), unit.id);
         }
     }
 
@@ -203,6 +395,7 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
                 bool hasReassigned = this->reassignResourceId(unit);
                 if (!hasReassigned) {
                     resourceObs_.emplace(unit.id, ResourceObs{ unit.id, unit.pos, defaultResources.at(unit.unitType) });
+                    resourcePosIndex_.emplace(resourcePositionKey(unit.pos), unit.id);
                 }
             }
 
@@ -216,14 +409,49 @@ template<typename DataSoA> class BaseConverter : public sc2::ReplayObserver
         }
     }
 
-    ReplayDatabase<DataSoA> database_;
+    /**
+     * @brief Output database and known hashes, private to this converter unless replaced via setSharedState.
+     */
+    std::shared_ptr<ConverterSharedState<DataSoA>> shared_ = std::make_shared<ConverterSharedState<DataSoA>>();
     DataSoA::struct_type replayData_;
     std::unordered_map<UID, ResourceObs> resourceObs_;
-    std::unordered_set<std::string> knownHashes_{};
+
+    /**
+     * @brief Position-keyed index into resourceObs_, maintained alongside it so snapshot-id reassignment is a hash
+     * lookup rather than a scan over every resource patch.
+     */
+    std::unordered_map<std::uint64_t, UID> resourcePosIndex_;
+
     bool mapDynHasLogged_{ false };
     bool mapHeightHasLogged_{ false };
     bool writeSuccess_{ false };
     std::chrono::high_resolution_clock::time_point start_{};
+
+    /**
+     * @brief Completed replays awaiting the background writer, bounded by maxQueuedWrites.
+     */
+    std::deque<typename DataSoA::struct_type> writeQueue_{};
+
+    /**
+     * @brief Number of replays queued or currently being written.
+     */
+    std::size_t pendingWrites_{ 0 };
+
+    /**
+     * @brief Set by the writer thread if a database write fails.
+     */
+    std::atomic<bool> writeFailure_{ false };
+
+    std::mutex writeMutex_{};
+    std::condition_variable_any writeCondVar_{};
+    std::jthread writerThread_{};
+
+    /**
+     * @brief Recycled step buffers from written replays, consumed by advanceStep. Refilled by the writer thread,
+     * hence guarded by its own mutex rather than writeMutex_ so OnStep never contends with a queued write.
+     */
+    std::vector<typename DataSoA::struct_type::step_type> stepPool_{};
+    std::mutex stepPoolMutex_{};
 };
 
 /**
@@ -0,0 +1,161 @@
+/**
+ * @file perf_stats.hpp
+ * @author Bryce Ferenczi
+ * @brief Lightweight per-stage timing/byte counters over the serializer hot paths. Instrumentation compiles to
+ * nothing unless SC2_PERF_STATS is defined (CMake option of the same name), with it enabled each instrumented scope
+ * adds one clock read and a few relaxed atomic increments. Aggregated stats are dumpable as JSON from the converter
+ * and queryable from Python via get_perf_stats().
+ * @version 0.1
+ * @date 2024-05-28
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace cvt::perf {
+
+/**
+ * @brief JSON keys of the instrumented stages, indexed by Stage.
+ */
+inline constexpr std::array gStageNames = { "db_read", "db_write", "compress", "decompress", "flatten", "step_copy" };
+
+/**
+ * @brief Instrumented pipeline stages. DbRead covers the whole entry read (decompress + deserialize), Compress and
+ * Decompress cover the per-column codecs, DbWrite covers entry serialization, compression and the disk write,
+ * Flatten covers unit flattening at write time and StepCopy the per-step observation copy in the converter.
+ */
+enum class Stage : std::size_t { DbRead = 0, DbWrite, Compress, Decompress, Flatten, StepCopy };
+
+/**
+ * @brief Accumulated call count, wall time and payload bytes of one stage.
+ */
+struct StageCounter
+{
+    std::atomic<std::uint64_t> calls{ 0 };
+    std::atomic<std::uint64_t> nanos{ 0 };
+    std::atomic<std::uint64_t> bytes{ 0 };
+};
+
+/**
+ * @brief Process-wide registry of stage counters. Recording is thread-safe and lock-free, reading while workers are
+ * active yields a consistent-enough snapshot for profiling purposes.
+ */
+class Registry
+{
+  public:
+    /**
+     * @brief The singleton counter registry.
+     */
+    [[nodiscard]] static auto get() noexcept -> Registry &
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    /**
+     * @brief Accumulate one timed scope into a stage counter.
+     */
+    void record(Stage stage, std::uint64_t nanos, std::uint64_t bytes) noexcept
+    {
+        auto &counter = counters_[static_cast<std::size_t>(stage)];
+        counter.calls.fetch_add(1, std::memory_order_relaxed);
+        counter.nanos.fetch_add(nanos, std::memory_order_relaxed);
+        counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Read the current counters of a stage as (calls, nanos, bytes).
+     */
+    [[nodiscard]] auto read(Stage stage) const noexcept -> std::array<std::uint64_t, 3>
+    {
+        const auto &counter = counters_[static_cast<std::size_t>(stage)];
+        return { counter.calls.load(std::memory_order_relaxed),
+            counter.nanos.load(std::memory_order_relaxed),
+            counter.bytes.load(std::memory_order_relaxed) };
+    }
+
+    /**
+     * @brief Zero all counters, e.g. between epochs or shards.
+     */
+    void reset() noexcept
+    {
+        for (auto &counter : counters_) {
+            counter.calls.store(0, std::memory_order_relaxed);
+            counter.nanos.store(0, std::memory_order_relaxed);
+            counter.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Render all counters as a single-line JSON object keyed by stage name.
+     */
+    [[nodiscard]] auto toJson() const -> std::string
+    {
+        std::string json = "{";
+        for (std::size_t idx = 0; idx < gStageNames.size(); ++idx) {
+            const auto [calls, nanos, bytes] = this->read(static_cast<Stage>(idx));
+            json += fmt::format("{}\"{}\":{{\"calls\":{},\"nanos\":{},\"bytes\":{}}}",
+                idx == 0 ? "" : ",",
+                gStageNames[idx],
+                calls,
+                nanos,
+                bytes);
+        }
+        json += "}";
+        return json;
+    }
+
+  private:
+    std::array<StageCounter, gStageNames.size()> counters_{};
+};
+
+/**
+ * @brief RAII timer accumulating the lifetime of the scope (and optionally a byte count) into a stage counter.
+ * Compiles to an empty struct unless SC2_PERF_STATS is defined.
+ */
+class [[maybe_unused]] ScopedTimer
+{
+#ifdef SC2_PERF_STATS
+  public:
+    explicit ScopedTimer(Stage stage, std::uint64_t bytes = 0) noexcept
+        : stage_(stage), bytes_(bytes), start_(std::chrono::steady_clock::now())
+    {}
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    auto operator=(const ScopedTimer &) -> ScopedTimer & = delete;
+
+    /**
+     * @brief Attribute additional payload bytes to this scope, e.g. once the written size is known.
+     */
+    void addBytes(std::uint64_t bytes) noexcept { bytes_ += bytes; }
+
+    ~ScopedTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        Registry::get().record(
+            stage_, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), bytes_);
+    }
+
+  private:
+    Stage stage_;
+    std::uint64_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+#else
+  public:
+    explicit ScopedTimer(Stage, std::uint64_t = 0) noexcept {}
+
+    void addBytes(std::uint64_t) noexcept {}
+#endif
+};
+
+}// namespace cvt::perf
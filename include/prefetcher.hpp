@@ -0,0 +1,249 @@
+/**
+ * @file prefetcher.hpp
+ * @author Bryce Ferenczi
+ * @brief Background prefetching pipeline over ReplayDatabase + ReplayParser. A worker thread decodes the next replay
+ * and pre-assembles sample batches into a bounded queue while the consumer (typically a GPU training loop) works on
+ * the current one, hiding the decode latency that otherwise stalls the first sample after each parse_replay. Exposed
+ * to Python as an iterator.
+ * @version 0.1
+ * @date 2024-08-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "database.hpp"
+#include "replay_parsing.hpp"
+
+#include <pybind11/pybind11.h>
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace cvt {
+
+/**
+ * @brief Iterates sequential sample-batch windows over a list of replays, assembling them on a background thread
+ * into a bounded queue ahead of the consumer. Batches are the py::dicts of ReplayParser::sampleBatch with
+ * "replay_index" and "start" added so the consumer can locate each window. The parser is owned by the prefetcher
+ * and may be configured (minimap features, feature dtype, ...) before start() but not while running.
+ * @tparam ReplayDataType Type of replay data structure in the database
+ */
+template<typename ReplayDataType> class ReplayPrefetcher
+{
+  public:
+    /**
+     * @brief Create a prefetcher over a database file.
+     * @param dbPath Path to the replay database to sample from
+     * @param infoPath Path to the yaml containing upgrade action data, forwarded to ReplayParser
+     * @param batchSize Number of consecutive timesteps per emitted batch
+     * @param queueDepth Number of pre-assembled batches buffered ahead of the consumer
+     */
+    ReplayPrefetcher(const std::filesystem::path &dbPath,
+        const std::filesystem::path &infoPath,
+        std::size_t batchSize,
+        std::size_t queueDepth = 4)
+        : parser_(infoPath), batchSize_(std::max<std::size_t>(batchSize, 1)),
+          queueDepth_(std::max<std::size_t>(queueDepth, 1))
+    {
+        if (!database_.load(dbPath)) {
+            throw std::runtime_error(fmt::format("Failed to load database: {}", dbPath.string()));
+        }
+    }
+
+    /**
+     * @brief Stop the worker and discard any queued batches.
+     */
+    ~ReplayPrefetcher() noexcept
+    {
+        try {
+            this->stop();
+        } catch (...) {
+            SPDLOG_LOGGER_ERROR(gLoggerDB, "Failed to stop prefetcher worker");
+        }
+    }
+
+    ReplayPrefetcher(const ReplayPrefetcher &) = delete;
+    auto operator=(const ReplayPrefetcher &) -> ReplayPrefetcher & = delete;
+
+    /**
+     * @brief Start prefetching over the given replay indices in order. Must not already be running.
+     * @param replayIndices Indices of the replays to iterate, empty means every entry in the database
+     */
+    void start(std::vector<std::size_t> replayIndices)
+    {
+        if (worker_.joinable()) { throw std::runtime_error("Prefetcher is already running"); }
+        if (replayIndices.empty()) {
+            replayIndices.resize(database_.size());
+            std::iota(replayIndices.begin(), replayIndices.end(), std::size_t{ 0 });
+        }
+        replayIndices_ = std::move(replayIndices);
+        finished_ = false;
+        error_ = nullptr;
+        worker_ = std::jthread([this](std::stop_token stopToken) { this->workerLoop(stopToken); });
+    }
+
+    /**
+     * @brief Stop the worker thread and discard queued batches. Safe to call when not running.
+     */
+    void stop()
+    {
+        if (!worker_.joinable()) { return; }
+        worker_.request_stop();
+        queueCondVar_.notify_all();
+        {
+            // The worker needs the GIL to finish assembling its current batch
+            py::gil_scoped_release release;
+            worker_.join();
+        }
+        worker_ = std::jthread{};
+        queue_.clear();
+    }
+
+    /**
+     * @brief Next pre-assembled batch, blocking (with the GIL released) until one is ready. Worker errors are
+     * rethrown here, exhaustion raises StopIteration for the python iterator protocol.
+     * @return Batch dictionary from ReplayParser::sampleBatch plus "replay_index" and "start" entries
+     */
+    [[nodiscard]] auto next() -> py::dict
+    {
+        std::optional<py::dict> batch;
+        std::exception_ptr workerError;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock lock(queueMutex_);
+            queueCondVar_.wait(lock, [this] { return !queue_.empty() || finished_; });
+            if (!queue_.empty()) {
+                batch = std::move(queue_.front());
+                queue_.pop_front();
+            } else {
+                workerError = error_;
+            }
+        }
+        queueCondVar_.notify_all();
+        if (batch.has_value()) { return std::move(*batch); }
+        if (workerError) { std::rethrow_exception(workerError); }
+        throw py::stop_iteration();
+    }
+
+    /**
+     * @brief Parser used to assemble batches, exposed so feature selection can be configured before start().
+     * @return Reference to the owned parser
+     */
+    [[nodiscard]] auto parser() noexcept -> ReplayParser<ReplayDataType> & { return parser_; }
+
+    /**
+     * @brief Check if the worker thread is currently running
+     * @return True if started and not yet stopped
+     */
+    [[nodiscard]] auto running() const noexcept -> bool { return worker_.joinable(); }
+
+  private:
+    /**
+     * @brief Worker main loop: decode each replay, then window it into batches pushed to the bounded queue. Batch
+     * assembly briefly takes the GIL for the numpy allocations, the parallel fill inside sampleBatch and all
+     * waiting happens with the GIL released.
+     * @param stopToken Token signalling stop() was called
+     */
+    void workerLoop(std::stop_token stopToken)
+    {
+        try {
+            for (auto &&replayIdx : replayIndices_) {
+                if (stopToken.stop_requested()) { break; }
+                parser_.parseReplay(database_.getEntry(replayIdx));
+                const std::size_t nSteps = parser_.size();
+                for (std::size_t start = 0; start < nSteps && !stopToken.stop_requested(); start += batchSize_) {
+                    py::dict batch;
+                    {
+                        py::gil_scoped_acquire gil;
+                        batch = parser_.sampleBatch(start, std::min(batchSize_, nSteps - start));
+                        batch["replay_index"] = replayIdx;
+                        batch["start"] = start;
+                    }
+                    this->pushBatch(std::move(batch), stopToken);
+                }
+            }
+        } catch (...) {
+            std::scoped_lock lock(queueMutex_);
+            error_ = std::current_exception();
+        }
+        {
+            std::scoped_lock lock(queueMutex_);
+            finished_ = true;
+        }
+        queueCondVar_.notify_all();
+    }
+
+    /**
+     * @brief Push a batch to the queue, blocking while it is at capacity. Dropped (not pushed) when stopping.
+     * @param batch Assembled batch to enqueue
+     * @param stopToken Token signalling stop() was called
+     */
+    void pushBatch(py::dict &&batch, std::stop_token stopToken)
+    {
+        std::unique_lock lock(queueMutex_);
+        queueCondVar_.wait(
+            lock, [&] { return queue_.size() < queueDepth_ || stopToken.stop_requested(); });
+        if (stopToken.stop_requested()) {
+            // Drop the leftover batch under the GIL rather than letting it decref GIL-free
+            lock.unlock();
+            py::gil_scoped_acquire gil;
+            py::dict discard{ std::move(batch) };
+            return;
+        }
+        queue_.emplace_back(std::move(batch));
+        lock.unlock();
+        queueCondVar_.notify_all();
+    }
+
+    /**
+     * @brief Source of replay data
+     */
+    ReplayDatabase<ReplayDataType> database_{};
+
+    /**
+     * @brief Parser that assembles the sample batches
+     */
+    ReplayParser<ReplayDataType> parser_;
+
+    /**
+     * @brief Number of consecutive timesteps per batch
+     */
+    std::size_t batchSize_;
+
+    /**
+     * @brief Maximum number of pre-assembled batches buffered ahead of the consumer
+     */
+    std::size_t queueDepth_;
+
+    /**
+     * @brief Replay indices iterated by the worker in order
+     */
+    std::vector<std::size_t> replayIndices_{};
+
+    /**
+     * @brief Pre-assembled batches awaiting the consumer, bounded by queueDepth_
+     */
+    std::deque<py::dict> queue_{};
+
+    /**
+     * @brief Set once the worker has drained replayIndices_ or hit an error
+     */
+    bool finished_{ false };
+
+    /**
+     * @brief First error raised by the worker, rethrown by next()
+     */
+    std::exception_ptr error_{};
+
+    std::mutex queueMutex_{};
+    std::condition_variable queueCondVar_{};
+    std::jthread worker_{};
+};
+
+}// namespace cvt
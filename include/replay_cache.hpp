@@ -0,0 +1,203 @@
+/**
+ * @file replay_cache.hpp
+ * @author Bryce Ferenczi
+ * @brief Process-shared LRU cache of decoded database entries. Multiple dataloader workers on the same node attach to
+ * a named shared-memory segment keyed by (database path, entry index) which holds the plain (post-decompression)
+ * serialized bytes of each entry, so popular replays are decompressed once per node rather than once per worker.
+ * @version 0.1
+ * @date 2024-05-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <spdlog/fmt/fmt.h>
+
+#include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/interprocess/containers/map.hpp>
+#include <boost/interprocess/containers/string.hpp>
+#include <boost/interprocess/containers/vector.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace cvt {
+
+namespace detail {
+
+    namespace bip = boost::interprocess;
+
+    using ShmSegmentManager = bip::managed_shared_memory::segment_manager;
+    using ShmCharAllocator = bip::allocator<char, ShmSegmentManager>;
+    using ShmString = bip::basic_string<char, std::char_traits<char>, ShmCharAllocator>;
+    using ShmBuffer = bip::vector<char, ShmCharAllocator>;
+
+    /**
+     * @brief Cached serialized entry bytes tagged with the tick of their last use for LRU eviction.
+     */
+    struct CacheSlot
+    {
+        CacheSlot(const ShmCharAllocator &alloc, std::uint64_t tick) : data(alloc), lastUsed(tick) {}
+
+        ShmBuffer data;
+        std::uint64_t lastUsed;
+    };
+
+    using ShmMapValue = std::pair<const ShmString, CacheSlot>;
+    using ShmMapAllocator = bip::allocator<ShmMapValue, ShmSegmentManager>;
+    using ShmMap = bip::map<ShmString, CacheSlot, std::less<>, ShmMapAllocator>;
+
+    /**
+     * @brief Root object of the cache segment, shared by every attached process. The mutex serializes lookups,
+     * insertions and evictions, the tick is a monotonic use-counter that orders slots for LRU eviction.
+     */
+    struct CacheState
+    {
+        explicit CacheState(const ShmMapAllocator &alloc) : entries(std::less<>(), alloc) {}
+
+        bip::interprocess_mutex mutex{};
+        std::uint64_t tick{ 0 };
+        ShmMap entries;
+    };
+
+}// namespace detail
+
+
+/**
+ * @brief Process-shared LRU cache of serialized database entries. Every process that constructs a cache with the same
+ * name attaches to the same fixed-size shared-memory segment, the first to do so creates it. Entries are keyed by the
+ * absolute database path and entry index and hold the entry serialized without compression, so a cache hit replaces
+ * disk read + decompression with a memcpy + deserialize. When an insertion does not fit, least-recently-used slots are
+ * evicted until it does. The segment outlives the processes using it and must be explicitly destroyed with remove().
+ */
+class SharedReplayCache
+{
+  public:
+    /**
+     * @brief Attach to (or create) the named cache segment.
+     * @param name OS-level name of the shared-memory segment, workers sharing a cache must agree on this.
+     * @param capacityBytes Size of the segment when this call creates it, ignored when attaching to an existing one.
+     */
+    explicit SharedReplayCache(const std::string &name, std::size_t capacityBytes = 512 * 1024 * 1024)
+        : name_(name), segment_(detail::bip::open_or_create, name.c_str(), capacityBytes)
+    {
+        state_ = segment_.find_or_construct<detail::CacheState>("CacheState")(
+            detail::ShmMapAllocator(segment_.get_segment_manager()));
+    }
+
+    /**
+     * @brief Look up the cached serialized bytes of a database entry and mark it most-recently-used.
+     * @param dbPath Path to the database the entry belongs to.
+     * @param index Index of the entry within the database.
+     * @return Copy of the cached bytes, or nullopt on a cache miss.
+     */
+    [[nodiscard]] auto find(const std::filesystem::path &dbPath, std::size_t index)
+        -> std::optional<std::vector<char>>
+    {
+        const auto key = makeKey(dbPath, index);
+        detail::bip::scoped_lock lock(state_->mutex);
+        auto slotIt = state_->entries.find(key.c_str());
+        if (slotIt == state_->entries.end()) { return std::nullopt; }
+        slotIt->second.lastUsed = ++state_->tick;
+        return std::vector<char>(slotIt->second.data.begin(), slotIt->second.data.end());
+    }
+
+    /**
+     * @brief Insert the serialized bytes of a database entry, evicting least-recently-used slots to make room. An
+     * entry larger than the segment itself is not cached.
+     * @param dbPath Path to the database the entry belongs to.
+     * @param index Index of the entry within the database.
+     * @param entryData Entry serialized without compression.
+     * @return True if the entry was inserted (or already present), false if it couldn't fit in an empty segment.
+     */
+    auto insert(const std::filesystem::path &dbPath, std::size_t index, std::span<const char> entryData) -> bool
+    {
+        const auto key = makeKey(dbPath, index);
+        detail::bip::scoped_lock lock(state_->mutex);
+        if (auto slotIt = state_->entries.find(key.c_str()); slotIt != state_->entries.end()) {
+            slotIt->second.lastUsed = ++state_->tick;
+            return true;
+        }
+        while (true) {
+            try {
+                detail::ShmCharAllocator alloc(segment_.get_segment_manager());
+                detail::CacheSlot slot(alloc, ++state_->tick);
+                slot.data.assign(entryData.begin(), entryData.end());
+                state_->entries.emplace(detail::ShmString(key.c_str(), alloc), std::move(slot));
+                return true;
+            } catch (const detail::bip::bad_alloc &) {
+                if (state_->entries.empty()) { return false; }
+                auto oldest = std::ranges::min_element(
+                    state_->entries, {}, [](const auto &keyValue) { return keyValue.second.lastUsed; });
+                state_->entries.erase(oldest);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of entries currently cached.
+     */
+    [[nodiscard]] auto size() -> std::size_t
+    {
+        detail::bip::scoped_lock lock(state_->mutex);
+        return state_->entries.size();
+    }
+
+    /**
+     * @brief Unused bytes remaining in the segment.
+     */
+    [[nodiscard]] auto freeBytes() const noexcept -> std::size_t { return segment_.get_free_memory(); }
+
+    /**
+     * @brief OS-level name of the segment this cache is attached to.
+     */
+    [[nodiscard]] auto name() const noexcept -> const std::string & { return name_; }
+
+    /**
+     * @brief Destroy the named segment. Call once per node after the last worker is done with it, existing
+     * attachments remain valid until they are destructed.
+     * @param name OS-level name of the shared-memory segment.
+     * @return True if the segment existed and was removed.
+     */
+    static auto remove(const std::string &name) noexcept -> bool
+    {
+        return detail::bip::shared_memory_object::remove(name.c_str());
+    }
+
+  private:
+    /**
+     * @brief Build the cache key for an entry, databases are identified by their absolute path so workers with
+     * different working directories agree on keys.
+     */
+    [[nodiscard]] static auto makeKey(const std::filesystem::path &dbPath, std::size_t index) -> std::string
+    {
+        return fmt::format("{}#{}", std::filesystem::absolute(dbPath).string(), index);
+    }
+
+    /**
+     * @brief OS-level name of the attached segment.
+     */
+    std::string name_;
+
+    /**
+     * @brief Shared-memory segment holding the cache, created by the first attaching process.
+     */
+    detail::bip::managed_shared_memory segment_;
+
+    /**
+     * @brief Root cache object within the segment.
+     */
+    detail::CacheState *state_;
+};
+
+}// namespace cvt
@@ -16,33 +16,67 @@
 #include "data_structures/units.hpp"
 #include "vectorize.hpp"
 
+#include <boost/pfr.hpp>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <filesystem>
+#include <mutex>
+#include <numeric>
 #include <ranges>
 #include <set>
 #include <span>
+#ifdef __STDCPP_FLOAT16_T__
+#include <stdfloat>
+#endif
+#include <thread>
+#include <unordered_set>
+#include <utility>
 
 
 namespace py = pybind11;
 
+#ifdef __STDCPP_FLOAT16_T__
+namespace pybind11::detail {
+
+/**
+ * @brief numpy format descriptor for std::float16_t which pybind11 lacks out of the box. "e" is the IEEE 754
+ * binary16 format character shared by the buffer protocol and numpy.
+ */
+template<> struct npy_format_descriptor<std::float16_t>
+{
+    static constexpr auto name = const_name("numpy.float16");
+    static auto dtype() -> pybind11::dtype { return pybind11::dtype("e"); }
+    static auto format() -> std::string { return "e"; }
+};
+
+}// namespace pybind11::detail
+#endif
+
 namespace cvt {
 
 /**
- * @brief UpgradeState class loads information stored in yaml and determines the time points of the game when an
- * upgrade is active for the player. This class can be queried with getState with a gameStep to return a one-hot
- * encoding of the currently active upgrades.
+ * @brief Output dtype of the feature arrays emitted by ReplayParser. Minimap layers and most unit features are
+ * one-hot or 8-bit at the source, so Float16/UInt8 shrink the pybind boundary and host-to-device copies 2-4x.
+ */
+enum class FeatureDType : std::uint8_t { Float32, Float16, UInt8 };
+
+/**
+ * @brief UpgradeState determines the time points of the game when an upgrade is active for the player. The upgrade
+ * timing data is compiled into the binary from generated_info.hpp (scripts/gen_info_header.py). This class can be
+ * queried with getState with a gameStep to return a one-hot encoding of the currently active upgrades.
  */
 class UpgradeState
 {
   public:
     /**
-     * @brief Create upgrade timing instance using information based on dataFile.
+     * @brief Create upgrade timing instance. Construction is free, the compiled-in upgrade table is used directly,
+     * dataFile is only parsed on demand for game versions missing from that table.
      * @param dataFile Path to the yaml containing upgrade action data for each game version and race.
      */
     explicit UpgradeState(std::filesystem::path dataFile);
@@ -97,8 +131,15 @@ class UpgradeState
     [[nodiscard]] auto getValidRemap() const -> const std::unordered_map<int, std::array<int, 3>> &;
 
     /**
-     * @brief Fill out the id2delay_ mapping with the information from dataFile_ based on the currentRace_ and
-     * gameVersion_
+     * @brief Mapping from action/upgrade id to research delay for gameVersion_, served from the compiled-in table
+     * with the lazily loaded yaml data as fallback.
+     * @return Mapping from upgrade ability id to research time in game steps.
+     */
+    [[nodiscard]] auto getDelayTable() const -> const std::unordered_map<int, int> &;
+
+    /**
+     * @brief Fill out the gameVersion2id2delay_ mapping with the information from dataFile_, only used for game
+     * versions that are missing from the compiled-in upgradeDelays table.
      */
     void loadInfo();
 
@@ -108,7 +149,8 @@ class UpgradeState
     std::filesystem::path dataFile_;
 
     /**
-     * @brief Mapping from action/upgrade id to the time it takes to research in game steps.
+     * @brief Fallback mapping from action/upgrade id to research time in game steps, lazily parsed from dataFile_
+     * when a game version is missing from the compiled-in table.
      */
     std::unordered_map<std::string, std::unordered_map<int, int>> gameVersion2id2delay_{};
 
@@ -143,12 +185,12 @@ template<typename T, typename UnitT>
     if (units.empty()) { return py::array_t<T>(); }
 
     // Create numpy array based on unit feature size
-    const bool expandOneHot{ true };
+    constexpr bool expandOneHot{ true };
     constexpr std::size_t unitDim = getVectorizedSize<UnitT>(expandOneHot);
     py::array_t<T> featureArray({ units.size(), unitDim });
     auto rawDataIt = featureArray.mutable_data();
     // cppcheck-suppress useStlAlgorithm
-    for (const auto &unit : units) { rawDataIt = vectorize(unit, rawDataIt, expandOneHot); }
+    for (const auto &unit : units) { rawDataIt = vectorize<expandOneHot>(unit, rawDataIt); }
     return featureArray;
 }
 
@@ -162,12 +204,13 @@ template<typename T>
     requires std::is_arithmetic_v<T>
 [[nodiscard]] auto transformUnitsByAlliance(const std::vector<Unit> &units) noexcept -> py::dict
 {
-    const static std::unordered_map<cvt::Alliance, std::string> enum2str = {
+    constexpr static std::array<std::pair<cvt::Alliance, const char *>, 4> enum2str = { {
+        { cvt::Alliance::Self, "self" },
         { cvt::Alliance::Ally, "ally" },
         { cvt::Alliance::Neutral, "neutral" },
-        { cvt::Alliance::Self, "self" },
         { cvt::Alliance::Enemy, "enemy" },
-    };
+    } };
+    const auto allianceIdx = [](cvt::Alliance alliance) { return static_cast<std::size_t>(alliance) - 1; };
 
     // Return dict of empty arrays if no units
     if (units.empty()) {
@@ -176,24 +219,25 @@ template<typename T>
         return pyDict;
     }
 
-    std::unordered_map<cvt::Alliance, std::vector<T>> groupedUnitFeatures = { { cvt::Alliance::Self, {} },
-        { cvt::Alliance::Ally, {} },
-        { cvt::Alliance::Enemy, {} },
-        { cvt::Alliance::Neutral, {} } };
+    constexpr bool expandOneHot{ true };
+    constexpr std::size_t unitDim = getVectorizedSize<Unit>(expandOneHot);
 
-    const bool expandOneHot{ true };
-    for (auto &&unit : units) {
-        auto &group = groupedUnitFeatures.at(unit.alliance);
-        std::ranges::copy(vectorize<T>(unit, expandOneHot), std::back_inserter(group));
-    }
+    // Count units per alliance so each feature array can be allocated up-front
+    std::array<std::size_t, enum2str.size()> counts{};
+    for (auto &&unit : units) { ++counts[allianceIdx(unit.alliance)]; }
 
     py::dict pyReturn;
-    constexpr std::size_t unitDim = getVectorizedSize<Unit>(expandOneHot);
-    for (auto &&[group, features] : groupedUnitFeatures) {
-        const std::size_t nUnits = features.size() / unitDim;
-        py::array_t<T> pyArray({ nUnits, unitDim });
-        std::ranges::copy(features, pyArray.mutable_data());
-        pyReturn[py::cast(enum2str.at(group))] = pyArray;
+    std::array<T *, enum2str.size()> groupIters{};
+    for (auto &&[alliance, name] : enum2str) {
+        py::array_t<T> pyArray({ counts[allianceIdx(alliance)], unitDim });
+        groupIters[allianceIdx(alliance)] = pyArray.mutable_data();
+        pyReturn[py::cast(name)] = std::move(pyArray);
+    }
+
+    // Vectorize each unit directly into its destination row, no intermediate allocations
+    for (auto &&unit : units) {
+        auto &dest = groupIters[allianceIdx(unit.alliance)];
+        dest = vectorize<expandOneHot>(unit, dest);
     }
     return pyReturn;
 }
@@ -310,7 +354,6 @@ struct MinimapFeatureFlags
  */
 template<typename ReplayDataType> class ReplayParser
 {
-    using feature_t = float;
     using step_data_t = typename ReplayDataType::step_type;
 
   public:
@@ -337,6 +380,25 @@ template<typename ReplayDataType> class ReplayParser
         }
     }
 
+    /**
+     * @brief Decode and ingest only a [start, start + count) step window of an entry, bounding parser memory by the
+     * window length rather than the replay length. Sample indices are then relative to start. Upgrade timings are
+     * calculated from the window's actions only, so research begun before the window is not reflected.
+     * @tparam Database database type offering a windowed decode of ReplayDataType entries
+     * @param database Database to read the entry window from
+     * @param index Index of the entry in the database
+     * @param start First step of the window
+     * @param count Number of steps in the window
+     */
+    template<typename Database>
+        requires requires(const Database &db, std::size_t index, std::size_t start, std::size_t count) {
+            { db.getEntryRange(index, start, count) } -> std::same_as<ReplayDataType>;
+        }
+    void parseReplayWindow(const Database &database, std::size_t index, std::size_t start, std::size_t count)
+    {
+        this->parseReplay(database.getEntryRange(index, start, count));
+    }
+
     /**
      * @brief Set whether to expand player_relative to one hot encoding or keep as enum values
      * @param flag true will expand player_relaitive
@@ -349,6 +411,19 @@ template<typename ReplayDataType> class ReplayParser
      */
     [[nodiscard]] auto getPlayerMinimapExpansion() const noexcept -> bool { return expandPlayerRelative_; }
 
+    /**
+     * @brief Set the output dtype of the feature arrays emitted by the sampling methods (default float32).
+     * float16 rounds to nearest, uint8 truncates values that exceed its range.
+     * @param dtype dtype of emitted feature arrays
+     */
+    void setFeatureDType(FeatureDType dtype) noexcept { featureDType_ = dtype; }
+
+    /**
+     * @brief Get the output dtype of emitted feature arrays
+     * @return Currently selected feature dtype
+     */
+    [[nodiscard]] auto getFeatureDType() const noexcept -> FeatureDType { return featureDType_; }
+
     /**
      * @brief Set the minimap features to stack and emit from the parser, if an empty list is given then all flags are
      * simply cleared/reset, if a single special key "all" is given then all flags are set.
@@ -387,6 +462,24 @@ template<typename ReplayDataType> class ReplayParser
         return ret;
     }
 
+    /**
+     * @brief Database entry columns required by the current minimap feature selection, suitable for
+     * ReplayDatabase::getEntryColumns. Disabled minimap layers are excluded so their I/O and decompression is skipped
+     * entirely; all non-minimap columns are always required by the sampling methods.
+     * @return Set of entry column names to load
+     */
+    [[nodiscard]] auto requiredColumns() const -> std::unordered_set<std::string>
+    {
+        std::unordered_set<std::string> columns;
+        constexpr auto columnNames = boost::pfr::names_as_array<decltype(std::declval<ReplayDataType>().data)>();
+        for (const auto &name : columnNames) {
+            auto nameStr = std::string(name);
+            const bool isMinimapLayer = std::ranges::contains(MinimapFeatureFlags::keys, nameStr);
+            if (!isMinimapLayer || minimapFeatureFlags_.test(nameStr)) { columns.emplace(std::move(nameStr)); }
+        }
+        return columns;
+    }
+
     /**
      * @brief Get a python dictionary containing features from that timestep
      * @param index index of replay sample
@@ -394,6 +487,17 @@ template<typename ReplayDataType> class ReplayParser
      * @return Dictionary containing feature data at that point in time
      */
     [[nodiscard]] auto sampleAll(std::size_t index, bool unit_alliance = false) const -> py::dict
+    {
+        return this->withFeatureType(
+            [&]<typename feature_t>() -> py::dict { return this->sampleAllImpl<feature_t>(index, unit_alliance); });
+    }
+
+  private:
+    /**
+     * @brief sampleAll with the feature dtype resolved to a concrete type
+     */
+    template<typename feature_t> [[nodiscard]] auto sampleAllImpl(std::size_t index, bool unit_alliance) const
+        -> py::dict
     {
         py::dict result;
 
@@ -436,16 +540,169 @@ template<typename ReplayDataType> class ReplayParser
         return result;
     }
 
+  public:
+    /**
+     * @brief Sample a contiguous window of timesteps with outputs stacked over time, see the index-list overload.
+     * @param start First time index of the window
+     * @param count Number of timesteps to sample
+     * @return Dictionary of stacked feature arrays
+     */
+    [[nodiscard]] auto sampleBatch(std::size_t start, std::size_t count) const -> py::dict
+    {
+        std::vector<std::size_t> indices(count);
+        std::iota(indices.begin(), indices.end(), start);
+        return this->sampleBatch(indices);
+    }
+
+    /**
+     * @brief Sample a batch of timesteps with outputs stacked over time: minimaps as (T,C,H,W), scalars as (T,D) and
+     * units zero-padded to (T,N,D) with a (T,) length vector. Timesteps are assembled in parallel over a thread pool
+     * with the GIL released. Actions and upgrade state are native python objects and remain per-step via sampleAll.
+     * @param indices Time indices to sample, duplicates are allowed
+     * @return Dictionary of stacked feature arrays
+     */
+    [[nodiscard]] auto sampleBatch(const std::vector<std::size_t> &indices) const -> py::dict
+    {
+        return this->withFeatureType(
+            [&]<typename feature_t>() -> py::dict { return this->sampleBatchImpl<feature_t>(indices); });
+    }
+
+  private:
+    /**
+     * @brief sampleBatch with the feature dtype resolved to a concrete type
+     */
+    template<typename feature_t>
+    [[nodiscard]] auto sampleBatchImpl(const std::vector<std::size_t> &indices) const -> py::dict
+    {
+        if (indices.empty()) { throw std::invalid_argument{ "No time indices given to sampleBatch" }; }
+        for (auto &&idx : indices) {
+            if (idx >= this->size()) {
+                throw std::out_of_range{ fmt::format("Time index {} exceeds replay length {}", idx, this->size()) };
+            }
+        }
+        const std::size_t nTime = indices.size();
+        constexpr bool expandOneHot{ true };
+        py::dict result;
+
+        // Allocate the stacked outputs and gather raw destination pointers while still holding the GIL
+        feature_t *unitsPtr{ nullptr };
+        feature_t *neutralUnitsPtr{ nullptr };
+        std::int64_t *unitLengthsPtr{ nullptr };
+        std::int64_t *neutralUnitLengthsPtr{ nullptr };
+        std::size_t maxUnits{ 0 };
+        std::size_t maxNeutralUnits{ 0 };
+        if constexpr (HasUnitData<step_data_t>) {
+            for (auto &&idx : indices) {
+                maxUnits = std::max(maxUnits, replayData_.data.units[idx].size());
+                maxNeutralUnits = std::max(maxNeutralUnits, replayData_.data.neutralUnits[idx].size());
+            }
+            py::array_t<feature_t> unitArray({ nTime, maxUnits, getVectorizedSize<Unit>(expandOneHot) });
+            unitsPtr = unitArray.mutable_data();
+            result["units"] = std::move(unitArray);
+            py::array_t<std::int64_t> unitLengths({ static_cast<py::ssize_t>(nTime) });
+            unitLengthsPtr = unitLengths.mutable_data();
+            result["unit_lengths"] = std::move(unitLengths);
+
+            py::array_t<feature_t> neutralUnitArray(
+                { nTime, maxNeutralUnits, getVectorizedSize<NeutralUnit>(expandOneHot) });
+            neutralUnitsPtr = neutralUnitArray.mutable_data();
+            result["neutral_units"] = std::move(neutralUnitArray);
+            py::array_t<std::int64_t> neutralUnitLengths({ static_cast<py::ssize_t>(nTime) });
+            neutralUnitLengthsPtr = neutralUnitLengths.mutable_data();
+            result["neutral_unit_lengths"] = std::move(neutralUnitLengths);
+        }
+
+        feature_t *minimapPtr{ nullptr };
+        std::size_t minimapStride{ 0 };
+        if constexpr (HasMinimapData<step_data_t>) {
+            const std::size_t nChannels = minimapFeatureFlags_.count() + (expandPlayerRelative_ ? 3 : 0);
+            const auto height = static_cast<std::size_t>(replayData_.header.heightMap._h);
+            const auto width = static_cast<std::size_t>(replayData_.header.heightMap._w);
+            minimapStride = nChannels * height * width;
+            py::array_t<feature_t> minimapArray({ nTime, nChannels, height, width });
+            minimapPtr = minimapArray.mutable_data();
+            result["minimaps"] = std::move(minimapArray);
+        }
+
+        feature_t *scalarPtr{ nullptr };
+        if constexpr (HasScalarData<step_data_t>) {
+            constexpr auto scalarDim = getScalarFeatureSize<decltype(replayData_.data)>();
+            py::array_t<feature_t> scalarArray({ nTime, scalarDim });
+            scalarPtr = scalarArray.mutable_data();
+            result["scalars"] = std::move(scalarArray);
+        }
+
+        auto assembleTimestep = [&](std::size_t item) {
+            const auto timeIdx = indices[item];
+            if constexpr (HasUnitData<step_data_t>) {
+                constexpr std::size_t unitDim = getVectorizedSize<Unit>(expandOneHot);
+                auto *unitDest = unitsPtr + item * maxUnits * unitDim;
+                const auto &units = replayData_.data.units[timeIdx];
+                for (const auto &unit : units) { unitDest = vectorize<expandOneHot>(unit, unitDest); }
+                std::fill(unitDest, unitsPtr + (item + 1) * maxUnits * unitDim, feature_t{ 0 });
+                unitLengthsPtr[item] = static_cast<std::int64_t>(units.size());
+
+                constexpr std::size_t neutralUnitDim = getVectorizedSize<NeutralUnit>(expandOneHot);
+                auto *neutralDest = neutralUnitsPtr + item * maxNeutralUnits * neutralUnitDim;
+                const auto &neutralUnits = replayData_.data.neutralUnits[timeIdx];
+                for (const auto &unit : neutralUnits) { neutralDest = vectorize<expandOneHot>(unit, neutralDest); }
+                std::fill(neutralDest, neutralUnitsPtr + (item + 1) * maxNeutralUnits * neutralUnitDim, feature_t{ 0 });
+                neutralUnitLengthsPtr[item] = static_cast<std::int64_t>(neutralUnits.size());
+            }
+            if constexpr (HasMinimapData<step_data_t>) {
+                writeMinimapFeatures(replayData_,
+                    timeIdx,
+                    minimapFeatureFlags_,
+                    expandPlayerRelative_,
+                    std::span(minimapPtr + item * minimapStride, minimapStride));
+            }
+            if constexpr (HasScalarData<step_data_t>) {
+                constexpr auto scalarDim = getScalarFeatureSize<decltype(replayData_.data)>();
+                writeScalarFeatures(replayData_.data, timeIdx, std::span(scalarPtr + item * scalarDim, scalarDim));
+            }
+        };
+
+        // Assemble timesteps in parallel with the GIL released, workers only touch the raw numpy buffers
+        std::exception_ptr firstError{};
+        {
+            py::gil_scoped_release release;
+            const std::size_t nWorkers =
+                std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), nTime);
+            std::atomic<std::size_t> nextItem{ 0 };
+            std::mutex errorMutex{};
+            std::vector<std::jthread> workers;
+            workers.reserve(nWorkers);
+            for (std::size_t w = 0; w < nWorkers; ++w) {
+                workers.emplace_back([&]() {
+                    for (std::size_t item = nextItem++; item < nTime; item = nextItem++) {
+                        try {
+                            assembleTimestep(item);
+                        } catch (...) {
+                            std::scoped_lock lock(errorMutex);
+                            if (!firstError) { firstError = std::current_exception(); }
+                            return;
+                        }
+                    }
+                });
+            }
+        }
+        if (firstError) { std::rethrow_exception(firstError); }
+        return result;
+    }
+
+  public:
     /**
      * @brief Sample all unit data from replay at index
      * @param index Index from replay to sample from
      * @return Unit data transformed into an array [N,D] where N is number of units, D is dimensionality of the feature
      * vector of each unit.
      */
-    [[nodiscard]] auto sampleUnits(std::size_t index) const
+    [[nodiscard]] auto sampleUnits(std::size_t index) const -> py::array
         requires HasUnitData<step_data_t>
     {
-        return transformUnits<feature_t>(replayData_.data.units[index]);
+        return this->withFeatureType([&]<typename feature_t>() -> py::array {
+            return transformUnits<feature_t>(replayData_.data.units[index]);
+        });
     }
 
     /**
@@ -453,10 +710,12 @@ template<typename ReplayDataType> class ReplayParser
      * @param index Index from replay to sample from
      * @return Dictionary of unit data transformed into a [N,D] array grouped by alliance
      */
-    [[nodiscard]] auto sampleUnitsGroupAlliance(std::size_t index) const
+    [[nodiscard]] auto sampleUnitsGroupAlliance(std::size_t index) const -> py::dict
         requires HasUnitData<step_data_t>
     {
-        return transformUnitsByAlliance<feature_t>(replayData_.data.units[index]);
+        return this->withFeatureType([&]<typename feature_t>() -> py::dict {
+            return transformUnitsByAlliance<feature_t>(replayData_.data.units[index]);
+        });
     }
 
     /**
@@ -464,10 +723,12 @@ template<typename ReplayDataType> class ReplayParser
      * @param index Index from replay to sample from
      * @return Neutral Unit data transformed into a [N,D] array
      */
-    [[nodiscard]] auto sampleNeutralUnits(std::size_t index) const
+    [[nodiscard]] auto sampleNeutralUnits(std::size_t index) const -> py::array
         requires HasUnitData<step_data_t>
     {
-        return transformUnits<feature_t>(replayData_.data.neutralUnits[index]);
+        return this->withFeatureType([&]<typename feature_t>() -> py::array {
+            return transformUnits<feature_t>(replayData_.data.neutralUnits[index]);
+        });
     }
 
     /**
@@ -486,10 +747,12 @@ template<typename ReplayDataType> class ReplayParser
      * @param index Index from replay to sample from
      * @return Minimap data transformed into an tensor [C,H,W] of the layers specified by minimapFeatureFlags
      */
-    [[nodiscard]] auto sampleMinimaps(std::size_t index) const
+    [[nodiscard]] auto sampleMinimaps(std::size_t index) const -> py::array
         requires HasMinimapData<step_data_t>
     {
-        return createMinimapFeatures<feature_t>(replayData_, index, minimapFeatureFlags_, expandPlayerRelative_);
+        return this->withFeatureType([&]<typename feature_t>() -> py::array {
+            return createMinimapFeatures<feature_t>(replayData_, index, minimapFeatureFlags_, expandPlayerRelative_);
+        });
     }
 
     /**
@@ -497,10 +760,12 @@ template<typename ReplayDataType> class ReplayParser
      * @param index Index from replay to sample from
      * @return Scalar data transformed into a vector
      */
-    [[nodiscard]] auto sampleScalars(std::size_t index) const
+    [[nodiscard]] auto sampleScalars(std::size_t index) const -> py::array
         requires HasScalarData<step_data_t>
     {
-        return createScalarFeatures<feature_t>(replayData_.data, index);
+        return this->withFeatureType([&]<typename feature_t>() -> py::array {
+            return createScalarFeatures<feature_t>(replayData_.data, index);
+        });
     }
 
     /**
@@ -529,6 +794,27 @@ template<typename ReplayDataType> class ReplayParser
     [[nodiscard]] auto info() const noexcept -> const ReplayInfo & { return replayData_.header; }
 
   private:
+    /**
+     * @brief Invoke func with the feature type selected by setFeatureDType as its explicit template argument.
+     * @param func Generic callable templated on the feature arithmetic type
+     * @return Result of func, which must not depend on the feature type
+     */
+    template<typename F> [[nodiscard]] auto withFeatureType(F &&func) const
+    {
+        switch (featureDType_) {
+        case FeatureDType::Float16:
+#ifdef __STDCPP_FLOAT16_T__
+            return func.template operator()<std::float16_t>();
+#else
+            throw std::runtime_error{ "float16 feature output is not supported by this toolchain" };
+#endif
+        case FeatureDType::UInt8:
+            return func.template operator()<std::uint8_t>();
+        default:
+            return func.template operator()<float>();
+        }
+    }
+
     /**
      * @brief Upgrade timing calculator
      */
@@ -550,6 +836,11 @@ template<typename ReplayDataType> class ReplayParser
      * @brief Flag to expand player relative from enum to one-hot in minimap.
      */
     bool expandPlayerRelative_{ true };
+
+    /**
+     * @brief Output dtype of emitted feature arrays.
+     */
+    FeatureDType featureDType_{ FeatureDType::Float32 };
 };
 
 
@@ -565,9 +856,11 @@ template<typename T, std::output_iterator<T> It>
 [[maybe_unused]] auto unpackBoolImage(const Image<bool> &image, It out) -> It
 {
     for (std::size_t i = 0; i < image.size(); ++i) {
-        const auto bitset = std::bitset<8>(std::to_integer<uint8_t>(image._data[i]));
+        // Expand eight packed bits to eight 0/1 bytes in one step, then widen to T
+        const auto spread = detail::spreadBitsToBytes(std::to_integer<std::uint8_t>(image._data[i]));
+        const auto bytes = std::bit_cast<std::array<std::uint8_t, 8>>(spread);
 #pragma unroll
-        for (int j = 7; j > -1; --j) { *out++ = static_cast<T>(bitset[j]); }
+        for (int j = 0; j < 8; ++j) { *out++ = static_cast<T>(bytes[static_cast<std::size_t>(j)]); }
     }
     return out;
 }
@@ -587,6 +880,37 @@ auto unpackBoolImage(const Image<bool> &image) noexcept -> std::vector<T>
     return unpacked_data;
 }
 
+/**
+ * @brief Number of scalar features emitted per timestep, the vectorized score plus the plain game state scalars.
+ * @tparam StepDataType SoA step data type
+ * @return Scalar feature vector length
+ */
+template<IsSoAType StepDataType> [[nodiscard]] constexpr auto getScalarFeatureSize() -> std::size_t
+{
+    using score_t = std::ranges::range_value_t<decltype(StepDataType::score)>;
+    return getVectorizedSize<score_t>(false) + 6;
+}
+
+/**
+ * @brief Write the scalar features of a timestep into preallocated contiguous data of getScalarFeatureSize length.
+ * @tparam T feature vector arithmetic type
+ * @param data replay data
+ * @param timeIdx time index to sample from replay
+ * @param outData span to write the feature vector into
+ */
+template<typename T, IsSoAType StepDataType>
+    requires std::is_arithmetic_v<T>
+void writeScalarFeatures(const StepDataType &data, std::size_t timeIdx, std::span<T> outData)
+{
+    auto outIt = vectorize<false>(data.score[timeIdx], outData.begin());
+    *outIt++ = static_cast<T>(data.minearals[timeIdx]);
+    *outIt++ = static_cast<T>(data.vespene[timeIdx]);
+    *outIt++ = static_cast<T>(data.popMax[timeIdx]);
+    *outIt++ = static_cast<T>(data.popArmy[timeIdx]);
+    *outIt++ = static_cast<T>(data.popWorkers[timeIdx]);
+    *outIt++ = static_cast<T>(data.gameStep[timeIdx]);
+}
+
 /**
  * @brief Convert game state of scalars into a feature vector.
  *        TODO: Have a dictionary of lambda functions that can normalize each of these features?
@@ -599,39 +923,29 @@ template<typename T, IsSoAType StepDataType>
     requires std::is_arithmetic_v<T>
 auto createScalarFeatures(const StepDataType &data, std::size_t timeIdx) -> py::array_t<T>
 {
-    auto feats = vectorize<T>(data.score[timeIdx]);
-    feats.emplace_back(data.minearals[timeIdx]);
-    feats.emplace_back(data.vespene[timeIdx]);
-    feats.emplace_back(data.popMax[timeIdx]);
-    feats.emplace_back(data.popArmy[timeIdx]);
-    feats.emplace_back(data.popWorkers[timeIdx]);
-    feats.emplace_back(data.gameStep[timeIdx]);
-    py::array_t<T> array({ static_cast<py::ssize_t>(feats.size()) });
-    std::ranges::copy(feats, array.mutable_data());
+    constexpr auto nFeatures = getScalarFeatureSize<StepDataType>();
+    py::array_t<T> array({ static_cast<py::ssize_t>(nFeatures) });
+    writeScalarFeatures(data, timeIdx, std::span(array.mutable_data(), nFeatures));
     return array;
 }
 
 /**
- * @brief Create Stacked Features Image from Minimap Data (C, H, W) in the order
+ * @brief Write Stacked Features Image from Minimap Data (C, H, W) into preallocated contiguous data in the order
  *        HeightMap, Visibility, Creep, Alerts, Buildable, Pathable, PlayerRelative
- * @tparam T Underlying type of returned image
+ * @tparam T Underlying type of written image
  * @param data Replay data
  * @param timeIdx Time index to sample from
  * @param expandPlayerRel Expand the Player Relative to four 1-hot channels (see cvt::Alliance)
- * @return Returns (C,H,W) Image of Type T
+ * @param outData span of (C,H,W) elements to write the stacked image into
  */
 template<typename T, typename ReplayDataType>
     requires std::is_arithmetic_v<T>
-auto createMinimapFeatures(const ReplayDataType &replay,
+void writeMinimapFeatures(const ReplayDataType &replay,
     std::size_t timeIdx,
     MinimapFeatureFlags includedLayers,
-    bool expandPlayerRel = true) -> py::array_t<T>
+    bool expandPlayerRel,
+    std::span<T> outData)
 {
-    const std::size_t nChannels = includedLayers.count() + (expandPlayerRel ? 3 : 0);
-    py::array_t<T> featureMap({ nChannels,
-        static_cast<std::size_t>(replay.header.heightMap._h),
-        static_cast<std::size_t>(replay.header.heightMap._w) });
-    std::span outData(featureMap.mutable_data(), featureMap.size());
     auto dataPtr = outData.begin();
 
     if (includedLayers.test("heightMap")) {
@@ -686,7 +1000,30 @@ auto createMinimapFeatures(const ReplayDataType &replay,
         }
         dataPtr = unpackBoolImage<T>(replay.data.pathable[timeIdx], dataPtr);
     }
+}
 
+/**
+ * @brief Create Stacked Features Image from Minimap Data (C, H, W) in the order
+ *        HeightMap, Visibility, Creep, Alerts, Buildable, Pathable, PlayerRelative
+ * @tparam T Underlying type of returned image
+ * @param data Replay data
+ * @param timeIdx Time index to sample from
+ * @param expandPlayerRel Expand the Player Relative to four 1-hot channels (see cvt::Alliance)
+ * @return Returns (C,H,W) Image of Type T
+ */
+template<typename T, typename ReplayDataType>
+    requires std::is_arithmetic_v<T>
+auto createMinimapFeatures(const ReplayDataType &replay,
+    std::size_t timeIdx,
+    MinimapFeatureFlags includedLayers,
+    bool expandPlayerRel = true) -> py::array_t<T>
+{
+    const std::size_t nChannels = includedLayers.count() + (expandPlayerRel ? 3 : 0);
+    py::array_t<T> featureMap({ nChannels,
+        static_cast<std::size_t>(replay.header.heightMap._h),
+        static_cast<std::size_t>(replay.header.heightMap._w) });
+    writeMinimapFeatures(
+        replay, timeIdx, includedLayers, expandPlayerRel, std::span(featureMap.mutable_data(), featureMap.size()));
     return featureMap;
 }
 
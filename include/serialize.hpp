@@ -19,6 +19,7 @@
 
 #include <concepts>
 #include <iostream>
+#include <vector>
 
 
 namespace cvt {
@@ -28,6 +29,52 @@ namespace cvt {
  */
 constexpr std::size_t gMaxRangeSize = 1'000'000'000;
 
+/**
+ * @brief Stream buffer that accumulates writes in a growable in-memory block. serialize() emits one stream.write per
+ * field, which is very slow through a compression filter chain; serializing into a BlockBuffer first and forwarding
+ * the whole block with writeTo coalesces those into a single large write to the compressor.
+ */
+class BlockBuffer : public std::streambuf
+{
+  public:
+    /**
+     * @brief Create block buffer with an initial capacity
+     * @param reserveSize bytes to preallocate (default 1MiB)
+     */
+    explicit BlockBuffer(std::size_t reserveSize = 1 << 20) { data_.reserve(reserveSize); }
+
+    /**
+     * @brief Write the accumulated block to the output stream in a single write
+     * @param stream output stream to forward the block to
+     */
+    void writeTo(std::ostream &stream) const
+    {
+        stream.write(data_.data(), static_cast<std::streamsize>(data_.size()));
+    }
+
+    /**
+     * @brief Number of bytes accumulated
+     * @return Number of bytes accumulated
+     */
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return data_.size(); }
+
+  protected:
+    auto overflow(int_type ch) -> int_type override
+    {
+        if (ch != traits_type::eof()) { data_.push_back(traits_type::to_char_type(ch)); }
+        return ch;
+    }
+
+    auto xsputn(const char *s, std::streamsize count) -> std::streamsize override
+    {
+        data_.insert(data_.end(), s, s + count);
+        return count;
+    }
+
+  private:
+    std::vector<char> data_{};
+};
+
 /**
  * @brief Serialize range of values to an output stream where the range is contiguous and the values are trivially
  * copyable.
@@ -147,6 +194,73 @@ void deserialize(T &data, std::istream &stream)
     boost::pfr::for_each_field(data, [&stream](auto &field) { deserialize(field, stream); });
 }
 
+/**
+ * @brief Serialize a vector of integers as zigzag deltas in LEB128 varint form. Monotonic or slowly-varying columns
+ * (sorted unit ids, game steps) shrink to roughly one byte per element before compression even sees them.
+ * @tparam T integral element type
+ * @param data column data to encode and serialize
+ * @param stream output stream to write data
+ */
+template<std::integral T> void serializeDeltaVarint(const std::vector<T> &data, std::ostream &stream)
+{
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+    constexpr auto signShift = sizeof(T) * 8 - 1;
+
+    std::vector<std::uint8_t> encoded;
+    encoded.reserve(data.size() * 2);
+    U prev = 0;
+    for (const auto &element : data) {
+        const auto current = static_cast<U>(element);
+        const auto delta = static_cast<S>(current - prev);
+        prev = current;
+        // Zigzag so small negative deltas stay small, then LEB128
+        auto value = static_cast<U>((static_cast<U>(delta) << 1) ^ static_cast<U>(delta >> signShift));
+        while (value >= 0x80) {
+            encoded.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        encoded.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    serialize(data.size(), stream);
+    serialize(encoded, stream);
+}
+
+/**
+ * @brief Deserialize a vector of integers written by serializeDeltaVarint.
+ * @tparam T integral element type
+ * @param data output reference to write decoded data
+ * @param stream input stream to read data from
+ */
+template<std::integral T> void deserializeDeltaVarint(std::vector<T> &data, std::istream &stream)
+{
+    using U = std::make_unsigned_t<T>;
+
+    std::size_t nElem = -1;
+    deserialize(nElem, stream);
+    if (nElem > gMaxRangeSize) { throw std::bad_array_new_length{}; }
+    std::vector<std::uint8_t> encoded;
+    deserialize(encoded, stream);
+
+    data.resize(nElem);
+    auto encodedIt = encoded.begin();
+    U prev = 0;
+    for (auto &element : data) {
+        U value = 0;
+        unsigned shift = 0;
+        while (encodedIt != encoded.end()) {
+            const auto byte = *encodedIt++;
+            value |= static_cast<U>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) { break; }
+            shift += 7;
+        }
+        const auto delta = static_cast<U>((value >> 1) ^ (~(value & 1) + 1));// Undo zigzag
+        prev += delta;
+        element = static_cast<T>(prev);
+    }
+}
+
 // I feel like this is cleaner but function resolution isn't working correctly
 // template<typename T> void serialize(const T &data, std::ofstream &fstream)
 // {
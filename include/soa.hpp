@@ -14,6 +14,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <span>
+#include <string_view>
+#include <tuple>
 
 namespace cvt {
 
@@ -174,4 +177,57 @@ template<IsSoAType SoA>
     return s;
 }
 
+/**
+ * @brief Find the index of the SoA column with the given name. Compilation fails if no column matches.
+ *
+ * @tparam SoA type to search
+ * @param name name of the column to find
+ * @return std::size_t index of the matching column, usable with sliceColumn.
+ */
+template<typename SoA> [[nodiscard]] consteval auto getColumnIndex(std::string_view name) -> std::size_t
+{
+    constexpr auto names = boost::pfr::names_as_array<SoA>();
+    const auto column = std::ranges::find(names, name);
+    if (column == names.end()) { throw "SoA has no column with the requested name"; }
+    return static_cast<std::size_t>(std::distance(names.begin(), column));
+}
+
+/**
+ * @brief Zero-copy view over one column of an SoA for the step range [start, end). Columns are contiguous so the
+ * returned span can be scanned at memcpy speed rather than reassembling structs with gatherStructAtIndex. The range
+ * is clamped to the column size, hence a truncated or empty span is returned for out-of-range requests.
+ *
+ * @tparam I index of the column in the SoA, resolvable by name with getColumnIndex.
+ * @tparam SoA type to view
+ * @param soa data to view, must outlive the returned span
+ * @param start first step of the slice
+ * @param end one-past-last step of the slice
+ * @return std::span over the selected column elements.
+ */
+template<std::size_t I, IsSoAType SoA>
+[[nodiscard]] auto sliceColumn(const SoA &soa, std::size_t start, std::size_t end) noexcept
+{
+    const auto &column = boost::pfr::get<I>(soa);
+    end = std::min(end, column.size());
+    start = std::min(start, end);
+    return std::span(column.data() + start, end - start);
+}
+
+/**
+ * @brief Zero-copy views over several columns of an SoA for the step range [start, end).
+ *
+ * @tparam Is indices of the columns in the SoA, resolvable by name with getColumnIndex.
+ * @tparam SoA type to view
+ * @param soa data to view, must outlive the returned spans
+ * @param start first step of the slice
+ * @param end one-past-last step of the slice
+ * @return std::tuple of std::span per selected column.
+ */
+template<std::size_t... Is, IsSoAType SoA>
+    requires(sizeof...(Is) > 1)
+[[nodiscard]] auto sliceColumns(const SoA &soa, std::size_t start, std::size_t end) noexcept
+{
+    return std::tuple{ sliceColumn<Is>(soa, start, end)... };
+}
+
 }// namespace cvt
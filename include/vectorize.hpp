@@ -16,23 +16,45 @@
 #include <boost/pfr.hpp>
 #include <spdlog/fmt/fmt.h>
 
+#include <cstring>
+#include <memory>
 #include <type_traits>
 
 namespace cvt {
 
 namespace detail {
+    /**
+     * @brief Whether vectorizing aggregate S to element type T is a plain block copy: every field is exactly of
+     * type T and the struct has no padding, hence the field-by-field walk writes the same bytes as one memcpy of
+     * the whole struct (e.g. cvt::Score into a float feature buffer).
+     * @tparam S Aggregate type to test
+     * @tparam T Element type of the output
+     * @return True if S can be copied into a T buffer with memcpy
+     */
+    template<typename S, typename T> consteval auto isBlockCopyable() -> bool
+    {
+        if constexpr (std::is_aggregate_v<S> && !std::ranges::range<S> && std::is_arithmetic_v<T>) {
+            S d{};// Make plain prototype for pfr::for_each_field
+            bool uniform = true;
+            boost::pfr::for_each_field(d, [&uniform]<typename F>(F) { uniform &= std::is_same_v<F, T>; });
+            return uniform && sizeof(S) == boost::pfr::tuple_size_v<S> * sizeof(T);
+        } else {
+            return false;
+        }
+    }
+
     /**
      * @brief Vectorize single arithmetic element by writing to output iterator It and incrementing
+     * @tparam OnehotEnum Flag to expand enum types to onehot, unused for arithmetic elements
      * @tparam T Arithmetic type
      * @tparam It Output iterator type
      * @param d Data to vectorize
      * @param it Output iterator
-     * @param onehotEnum flag to expand enum types to onehot
      * @return Incremented output iterator
      */
-    template<typename T, typename It>
+    template<bool OnehotEnum, typename T, typename It>
         requires std::is_arithmetic_v<T>
-    auto vectorize_helper(T d, It it, bool) -> It
+    auto vectorize_helper(T d, It it) -> It
     {
         *it++ = static_cast<std::iter_value_t<It>>(d);
         return it;
@@ -40,35 +62,35 @@ namespace detail {
 
     /**
      * @brief Vectorize range of arithmetic elements by writing to and incrementing output iterator
+     * @tparam OnehotEnum Flag to expand enum types to onehot, unused for arithmetic ranges
      * @tparam T Range type
      * @tparam It Output iterator type
      * @param d Range data to vectorize
      * @param it Output iterator
-     * @param onehotEnum flag to expand enum types to onehot
      * @return Incremented output iterator
      */
-    template<std::ranges::range T, typename It>
+    template<bool OnehotEnum, std::ranges::range T, typename It>
         requires std::is_arithmetic_v<std::ranges::range_value_t<T>>
-    auto vectorize_helper(const T &d, It it, bool) -> It
+    auto vectorize_helper(const T &d, It it) -> It
     {
         return std::ranges::transform(d, it, [](auto e) { return static_cast<std::iter_value_t<It>>(e); }).out;
     }
 
     /**
      * @brief Vectorize enum type and optionally expand to onehot encoding to and incrementing output iterator
+     * @tparam OnehotEnum Flag to expand enum types to onehot, resolved at compile time
      * @tparam T Enum type
      * @tparam It Output iterator type
      * @param d Enum data to vectorize
      * @param it Output iterator
-     * @param onehotEnum flag to expand enum types to onehot
      * @return Incremented output iterator
      */
-    template<typename T, typename It>
+    template<bool OnehotEnum, typename T, typename It>
         requires std::is_enum_v<T>
-    auto vectorize_helper(T d, It it, bool onehotEnum) -> It
+    auto vectorize_helper(T d, It it) -> It
     {
         using value_type = std::iter_value_t<It>;
-        if (onehotEnum) {
+        if constexpr (OnehotEnum) {
             it = std::ranges::copy(enumToOneHot<value_type>(d), it).out;
         } else {
             *it++ = static_cast<value_type>(d);
@@ -77,21 +99,27 @@ namespace detail {
     }
 
     /**
-     * @brief Vectorize struct (aggregate type) to data
+     * @brief Vectorize struct (aggregate type) to data. Aggregates whose layout already matches the output element
+     * type degrade to a single memcpy rather than a field-by-field walk.
+     * @tparam OnehotEnum Flag to expand enum types to onehot, resolved at compile time
      * @tparam T Struct type
      * @tparam It Output iterator type
      * @param d Struct to vectorize
      * @param it Output iterator
-     * @param onehotEnum flag to expand enum types to onehot
      * @return Incremented output iterator
      */
-    template<typename T, typename It>
+    template<bool OnehotEnum, typename T, typename It>
         requires std::is_aggregate_v<T> && (!std::ranges::range<T>)
-    auto vectorize_helper(T d, It it, bool onehotEnum) -> It
+    auto vectorize_helper(const T &d, It it) -> It
     {
-        boost::pfr::for_each_field(
-            d, [&it, onehotEnum](const auto &field) { it = detail::vectorize_helper(field, it, onehotEnum); });
-        return it;
+        if constexpr (isBlockCopyable<T, std::iter_value_t<It>>() && std::contiguous_iterator<It>) {
+            std::memcpy(std::to_address(it), &d, sizeof(T));
+            return std::next(it, static_cast<std::iter_difference_t<It>>(boost::pfr::tuple_size_v<T>));
+        } else {
+            boost::pfr::for_each_field(
+                d, [&it](const auto &field) { it = detail::vectorize_helper<OnehotEnum>(field, it); });
+            return it;
+        }
     }
 
     /**
@@ -143,6 +171,24 @@ template<typename T>
     }
 }
 
+/**
+ * @brief Vectorize Struct of data to mutable output iterator with the onehot policy fixed at compile time. Each
+ * (struct, output type, onehot) combination instantiates its own fully inlined plan with no per-field runtime
+ * dispatch, and layout-compatible aggregates are copied with memcpy, so prefer this overload in per-unit hot loops.
+ * @tparam OnehotEnum Flag to expand enum types to onehot encoding
+ * @tparam S struct type
+ * @tparam It output iterator type
+ * @param s Struct data to vectorize
+ * @param it Output iterator
+ * @return Incremented output iterator
+ */
+template<bool OnehotEnum, typename S, typename It>
+    requires std::is_aggregate_v<S> && std::is_arithmetic_v<std::iter_value_t<It>>
+[[maybe_unused]] auto vectorize(const S &s, It it) -> It
+{
+    return detail::vectorize_helper<OnehotEnum>(s, it);
+}
+
 /**
  * @brief Vectorize Struct of data to mutable output iterator
  * @tparam S struct type
@@ -156,9 +202,7 @@ template<typename S, typename It>
     requires std::is_aggregate_v<S> && std::is_arithmetic_v<std::iter_value_t<It>>
 [[maybe_unused]] auto vectorize(S s, It it, bool onehotEnum = false) -> It
 {
-    boost::pfr::for_each_field(
-        s, [&it, onehotEnum](const auto &field) { it = detail::vectorize_helper(field, it, onehotEnum); });
-    return it;
+    return onehotEnum ? vectorize<true>(s, it) : vectorize<false>(s, it);
 }
 
 /**
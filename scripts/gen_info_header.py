@@ -14,6 +14,7 @@ https://starcraft.fandom.com/wiki/Minerals
 from pathlib import Path
 
 import typer
+import yaml
 from pysc2.lib.units import Neutral, Protoss, Terran, Zerg
 
 from utils import upgrade_map
@@ -93,8 +94,29 @@ def add_research_remapping(content: str):
     return content
 
 
+def add_upgrade_delays(content: str, game_info: Path):
+    """Add mapping from upgrade ability id to research delay for each game version"""
+    with open(game_info, "r", encoding="utf-8") as f:
+        game_data = yaml.safe_load(f)
+    content += "\n// Research delay (game steps) of each upgrade ability id by game version\n"
+    content += (
+        "const static std::unordered_map<std::string, "
+        "std::unordered_map<int, int>> upgradeDelays = {\n"
+    )
+    for entry in game_data:
+        delays = ", ".join(
+            f"{{{u['ability_id']},{int(u['time'])}}}" for u in entry["upgrades"]
+        )
+        content += f'    {{"{entry["version"]}", {{ {delays} }}}},\n'
+    content += "};\n"
+    return content
+
+
 @app.command()
-def main(out_folder: Path = Path(".")):
+def main(
+    out_folder: Path = Path("."),
+    game_info: Path = Path("src/sc2_serializer/game_info.yaml"),
+):
     """Generate C++ Game Info Header based on values from PySC2"""
     content = r"""// ---- Generated by scripts/gen_info_header.py ----
 #pragma once
@@ -112,6 +134,7 @@ namespace cvt {
     content = add_resource_mapping(content)
     content = add_research_grouping(content)
     content = add_research_remapping(content)
+    content = add_upgrade_delays(content, game_info)
 
     # Footer
     content += "\n// clang-format on\n}// namespace cvt\n"
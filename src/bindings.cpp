@@ -13,6 +13,9 @@
 #include "data_structures/replay_minimaps.hpp"
 #include "data_structures/replay_scalars.hpp"
 #include "database.hpp"
+#include "perf_stats.hpp"
+#include "prefetcher.hpp"
+#include "replay_cache.hpp"
 #include "replay_parsing.hpp"
 
 #include <pybind11/functional.h>// Include this header for Pybind11 string conversions
@@ -46,6 +49,15 @@ template<typename T> void bindImage(py::module &m, const std::string &name)
                 std::ranges::copy(img.as_span(), out.mutable_data());
                 return out;
             })
+        .def_property_readonly("view",
+            [](py::object &self) {
+                // Zero-copy view over the image buffer, the base handle keeps the owning image alive
+                auto &img = self.cast<cvt::Image<T> &>();
+                return py::array_t<T>({ static_cast<std::size_t>(img._h), static_cast<std::size_t>(img._w) },
+                    { sizeof(T) * static_cast<std::size_t>(img._w), sizeof(T) },
+                    img.data(),
+                    self);
+            })
         .def_buffer([](cvt::Image<T> &img) -> py::buffer_info {
             return py::buffer_info(img.data(),
                 sizeof(T),
@@ -77,6 +89,26 @@ template<> void bindImage<bool>(py::module &m, const std::string &name)
         });
 }
 
+/**
+ * @brief Bind a zero-copy numpy view over a contiguous arithmetic column vector as "<name>_view". The view references
+ * the column storage directly and keeps the owning SoA object alive; the copying accessor of the same name is retained
+ * for users who need ownership.
+ * @tparam Class owning SoA class
+ * @tparam T arithmetic element type of the column
+ * @param cls pybind class to add the view property to
+ * @param name python name of the column
+ * @param member pointer to the column member vector
+ */
+template<typename Class, typename T>
+    requires std::is_arithmetic_v<T>
+void defColumnView(py::class_<Class> &cls, const std::string &name, std::vector<T> Class::*member)
+{
+    cls.def_property_readonly((name + "_view").c_str(), [member](py::object &self) {
+        auto &column = self.cast<Class &>().*member;
+        return py::array_t<T>({ column.size() }, { sizeof(T) }, column.data(), self);
+    });
+}
+
 /**
  * @brief Create python bindings for replay data struct and database.
  * @tparam T underlying replay data struct type
@@ -95,27 +127,96 @@ template<typename T> void bindReplayDataInterfaces(py::module &m, const std::str
         });
 
     const auto dbName = name + "Database";
-    py::class_<cvt::ReplayDatabase<T>>(m, dbName.c_str())
-        .def(py::init<>())
+    py::class_<cvt::ReplayDatabase<T>> database(m, dbName.c_str());
+    database.def(py::init<>())
         .def(py::init<const std::filesystem::path &>(), py::arg("dbPath"))
-        .def("open", &cvt::ReplayDatabase<T>::open, py::arg("dbPath"))
-        .def("create", &cvt::ReplayDatabase<T>::create, py::arg("dbPath"))
-        .def("load", &cvt::ReplayDatabase<T>::load, py::arg("dbPath"))
+        .def("open", &cvt::ReplayDatabase<T>::open, py::arg("dbPath"), py::call_guard<py::gil_scoped_release>())
+        .def("create", &cvt::ReplayDatabase<T>::create, py::arg("dbPath"), py::call_guard<py::gil_scoped_release>())
+        .def("load", &cvt::ReplayDatabase<T>::load, py::arg("dbPath"), py::call_guard<py::gil_scoped_release>())
         .def("isFull", &cvt::ReplayDatabase<T>::isFull)
         .def("size", &cvt::ReplayDatabase<T>::size)
         .def("__len__", &cvt::ReplayDatabase<T>::size)
-        .def("addEntry", &cvt::ReplayDatabase<T>::addEntry, py::arg("data"))
-        .def("getEntry", &cvt::ReplayDatabase<T>::getEntry, py::arg("index"))
-        .def("__getitem__", &cvt::ReplayDatabase<T>::getEntry, py::arg("index"))
-        .def("getHeader", &cvt::ReplayDatabase<T>::getHeader, py::arg("index"))
-        .def("getEntryUID", &cvt::ReplayDatabase<T>::getEntryUID, py::arg("index"))
+        .def("addEntry", &cvt::ReplayDatabase<T>::addEntry, py::arg("data"), py::call_guard<py::gil_scoped_release>())
+        .def("setWriteCodec", &cvt::ReplayDatabase<T>::setWriteCodec, py::arg("codec"))
+        .def("getWriteCodec", &cvt::ReplayDatabase<T>::getWriteCodec)
+        .def("setBatchSize", &cvt::ReplayDatabase<T>::setBatchSize, py::arg("batchSize"))
+        .def("flush", &cvt::ReplayDatabase<T>::flush, py::call_guard<py::gil_scoped_release>())
+        .def("getEntry", &cvt::ReplayDatabase<T>::getEntry, py::arg("index"), py::call_guard<py::gil_scoped_release>())
+        .def(
+            "getEntries",
+            [](const cvt::ReplayDatabase<T> &db, const std::vector<std::size_t> &indices) {
+                return db.getEntries(indices);
+            },
+            py::arg("indices"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("__getitem__", &cvt::ReplayDatabase<T>::getEntry, py::arg("index"), py::call_guard<py::gil_scoped_release>())
+        .def("getHeader", &cvt::ReplayDatabase<T>::getHeader, py::arg("index"), py::call_guard<py::gil_scoped_release>())
+        .def("getAllHeaders", &cvt::ReplayDatabase<T>::getAllHeaders, py::call_guard<py::gil_scoped_release>())
+        .def("getEntryUID", &cvt::ReplayDatabase<T>::getEntryUID, py::arg("index"), py::call_guard<py::gil_scoped_release>())
+        .def("attachCache", &cvt::ReplayDatabase<T>::attachCache, py::arg("cache"))
         .def_property_readonly("path", &cvt::ReplayDatabase<T>::path);
 
+    if constexpr (cvt::HasColumnInterface<T>) {
+        database.def("getEntryColumns",
+            &cvt::ReplayDatabase<T>::getEntryColumns,
+            py::arg("index"),
+            py::arg("columns"),
+            py::call_guard<py::gil_scoped_release>());
+    }
+
+    if constexpr (cvt::HasRangeInterface<T>) {
+        database.def("getEntryRange",
+            &cvt::ReplayDatabase<T>::getEntryRange,
+            py::arg("index"),
+            py::arg("start"),
+            py::arg("count"),
+            py::call_guard<py::gil_scoped_release>());
+    }
+
+    const auto shardedDbName = name + "ShardedDatabase";
+    py::class_<cvt::ShardedReplayDatabase<T>>(m, shardedDbName.c_str())
+        .def(py::init<>())
+        .def(py::init<const std::filesystem::path &>(), py::arg("folder"))
+        .def("open",
+            &cvt::ShardedReplayDatabase<T>::open,
+            py::arg("folder"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("size", &cvt::ShardedReplayDatabase<T>::size)
+        .def("__len__", &cvt::ShardedReplayDatabase<T>::size)
+        .def("numShards", &cvt::ShardedReplayDatabase<T>::numShards)
+        .def("getEntry",
+            &cvt::ShardedReplayDatabase<T>::getEntry,
+            py::arg("index"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("__getitem__",
+            &cvt::ShardedReplayDatabase<T>::getEntry,
+            py::arg("index"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("getHeader",
+            &cvt::ShardedReplayDatabase<T>::getHeader,
+            py::arg("index"),
+            py::call_guard<py::gil_scoped_release>())
+        .def("getEntryUID",
+            &cvt::ShardedReplayDatabase<T>::getEntryUID,
+            py::arg("index"),
+            py::call_guard<py::gil_scoped_release>())
+        .def_property_readonly("path", &cvt::ShardedReplayDatabase<T>::path);
+
     const auto parserName = name + "Parser";
     py::class_<cvt::ReplayParser<T>> parser(m, parserName.c_str());
     parser.def(py::init<const std::filesystem::path &>(), py::arg("info_path"))
         .def("sample_all", &cvt::ReplayParser<T>::sampleAll, py::arg("index"), py::arg("unit_alliance") = false)
-        .def("parse_replay", &cvt::ReplayParser<T>::parseReplay, py::arg("replay_data"))
+        .def("sample_batch",
+            py::overload_cast<std::size_t, std::size_t>(&cvt::ReplayParser<T>::sampleBatch, py::const_),
+            py::arg("start"),
+            py::arg("count"))
+        .def("sample_batch",
+            py::overload_cast<const std::vector<std::size_t> &>(&cvt::ReplayParser<T>::sampleBatch, py::const_),
+            py::arg("indices"))
+        .def("parse_replay",
+            &cvt::ReplayParser<T>::parseReplay,
+            py::arg("replay_data"),
+            py::call_guard<py::gil_scoped_release>())
         .def("size", &cvt::ReplayParser<T>::size)
         .def("__len__", &cvt::ReplayParser<T>::size)
         .def("empty", &cvt::ReplayParser<T>::empty)
@@ -123,6 +224,9 @@ template<typename T> void bindReplayDataInterfaces(py::module &m, const std::str
         .def("getPlayerMinimapExpansion", &cvt::ReplayParser<T>::getPlayerMinimapExpansion)
         .def("setMinimapFeatures", &cvt::ReplayParser<T>::setMinimapFeatures, py::arg("features"))
         .def("getMinimapFeatures", &cvt::ReplayParser<T>::getMinimapFeatures)
+        .def("setFeatureDType", &cvt::ReplayParser<T>::setFeatureDType, py::arg("dtype"))
+        .def("getFeatureDType", &cvt::ReplayParser<T>::getFeatureDType)
+        .def("requiredColumns", &cvt::ReplayParser<T>::requiredColumns)
         .def_property_readonly("data", &cvt::ReplayParser<T>::data, py::return_value_policy::reference_internal)
         .def_property_readonly("info", &cvt::ReplayParser<T>::info, py::return_value_policy::reference_internal);
 
@@ -138,6 +242,16 @@ template<typename T> void bindReplayDataInterfaces(py::module &m, const std::str
         parser.def("sample_minimaps", &cvt::ReplayParser<T>::sampleMinimaps, py::arg("index"));
     }
 
+    if constexpr (cvt::HasRangeInterface<T>) {
+        parser.def("parse_replay_window",
+            &cvt::ReplayParser<T>::template parseReplayWindow<cvt::ReplayDatabase<T>>,
+            py::arg("database"),
+            py::arg("index"),
+            py::arg("start"),
+            py::arg("count"),
+            py::call_guard<py::gil_scoped_release>());
+    }
+
     if constexpr (cvt::HasScalarData<step_data_t>) {
         parser.def("sample_scalars", &cvt::ReplayParser<T>::sampleScalars, py::arg("index"));
     }
@@ -145,6 +259,21 @@ template<typename T> void bindReplayDataInterfaces(py::module &m, const std::str
     if constexpr (cvt::HasActionData<step_data_t>) {
         parser.def("sample_actions", &cvt::ReplayParser<T>::sampleActions, py::arg("index"));
     }
+
+    const auto prefetcherName = name + "Prefetcher";
+    py::class_<cvt::ReplayPrefetcher<T>>(m, prefetcherName.c_str())
+        .def(py::init<const std::filesystem::path &, const std::filesystem::path &, std::size_t, std::size_t>(),
+            py::arg("db_path"),
+            py::arg("info_path"),
+            py::arg("batch_size"),
+            py::arg("queue_depth") = 4)
+        .def("start", &cvt::ReplayPrefetcher<T>::start, py::arg("indices") = std::vector<std::size_t>{})
+        .def("stop", &cvt::ReplayPrefetcher<T>::stop)
+        .def("running", &cvt::ReplayPrefetcher<T>::running)
+        .def("__iter__", [](py::object self) { return self; })
+        .def("__next__", &cvt::ReplayPrefetcher<T>::next)
+        .def_property_readonly(
+            "parser", &cvt::ReplayPrefetcher<T>::parser, py::return_value_policy::reference_internal);
 }
 
 
@@ -206,6 +335,17 @@ void bindEnums(py::module &m)
         .value("off", spdlog::level::level_enum::off)
         .export_values();
 
+    py::enum_<cvt::Codec>(m, "Codec")
+        .value("Zlib", cvt::Codec::Zlib)
+        .value("Zstd", cvt::Codec::Zstd)
+        .export_values();
+
+    py::enum_<cvt::FeatureDType>(m, "FeatureDType")
+        .value("Float32", cvt::FeatureDType::Float32)
+        .value("Float16", cvt::FeatureDType::Float16)
+        .value("UInt8", cvt::FeatureDType::UInt8)
+        .export_values();
+
     py::enum_<cvt::AddOn>(m, "AddOn")
         .value("NONE", cvt::AddOn::None)
         .value("Reactor", cvt::AddOn::Reactor)
@@ -400,8 +540,8 @@ PYBIND11_MODULE(_sc2_serializer, m)
         .def_readwrite("popWorkers", &cvt::StepDataNoUnitsMinimap::popWorkers)
         .def_readwrite("score", &cvt::StepDataNoUnitsMinimap::score);
 
-    py::class_<cvt::StepDataNoUnitsMinimapSoA>(m, "StepDataNoUnitsMinimapSoA")
-        .def(py::self == py::self)
+    py::class_<cvt::StepDataNoUnitsMinimapSoA> stepDataScalarSoA(m, "StepDataNoUnitsMinimapSoA");
+    stepDataScalarSoA.def(py::self == py::self)
         .def(py::self != py::self)
         .def_readwrite("gameStep", &cvt::StepDataNoUnitsMinimapSoA::gameStep)
         .def_readwrite("minerals", &cvt::StepDataNoUnitsMinimapSoA::minearals)
@@ -415,6 +555,12 @@ PYBIND11_MODULE(_sc2_serializer, m)
             if (i >= t.size()) { throw py::index_error(); }
             return t[i];
         });
+    defColumnView(stepDataScalarSoA, "gameStep", &cvt::StepDataNoUnitsMinimapSoA::gameStep);
+    defColumnView(stepDataScalarSoA, "minerals", &cvt::StepDataNoUnitsMinimapSoA::minearals);
+    defColumnView(stepDataScalarSoA, "vespene", &cvt::StepDataNoUnitsMinimapSoA::vespene);
+    defColumnView(stepDataScalarSoA, "popMax", &cvt::StepDataNoUnitsMinimapSoA::popMax);
+    defColumnView(stepDataScalarSoA, "popArmy", &cvt::StepDataNoUnitsMinimapSoA::popArmy);
+    defColumnView(stepDataScalarSoA, "popWorkers", &cvt::StepDataNoUnitsMinimapSoA::popWorkers);
 
     py::class_<cvt::StepDataNoUnits>(m, "StepDataNoUnits")
         .def(py::self == py::self)
@@ -433,8 +579,8 @@ PYBIND11_MODULE(_sc2_serializer, m)
         .def_readwrite("buildable", &cvt::StepDataNoUnits::buildable)
         .def_readwrite("pathable", &cvt::StepDataNoUnits::pathable);
 
-    py::class_<cvt::StepDataNoUnitsSoA>(m, "StepDataNoUnitsSoA")
-        .def(py::self == py::self)
+    py::class_<cvt::StepDataNoUnitsSoA> stepDataNoUnitsSoA(m, "StepDataNoUnitsSoA");
+    stepDataNoUnitsSoA.def(py::self == py::self)
         .def(py::self != py::self)
         .def_readwrite("gameStep", &cvt::StepDataNoUnitsSoA::gameStep)
         .def_readwrite("minerals", &cvt::StepDataNoUnitsSoA::minearals)
@@ -454,6 +600,12 @@ PYBIND11_MODULE(_sc2_serializer, m)
             if (i >= t.size()) { throw py::index_error(); }
             return t[i];
         });
+    defColumnView(stepDataNoUnitsSoA, "gameStep", &cvt::StepDataNoUnitsSoA::gameStep);
+    defColumnView(stepDataNoUnitsSoA, "minerals", &cvt::StepDataNoUnitsSoA::minearals);
+    defColumnView(stepDataNoUnitsSoA, "vespene", &cvt::StepDataNoUnitsSoA::vespene);
+    defColumnView(stepDataNoUnitsSoA, "popMax", &cvt::StepDataNoUnitsSoA::popMax);
+    defColumnView(stepDataNoUnitsSoA, "popArmy", &cvt::StepDataNoUnitsSoA::popArmy);
+    defColumnView(stepDataNoUnitsSoA, "popWorkers", &cvt::StepDataNoUnitsSoA::popWorkers);
 
     py::class_<cvt::StepData>(m, "StepData")
         .def(py::self == py::self)
@@ -475,8 +627,8 @@ PYBIND11_MODULE(_sc2_serializer, m)
         .def_readwrite("units", &cvt::StepData::units)
         .def_readwrite("neutralUnits", &cvt::StepData::neutralUnits);
 
-    py::class_<cvt::StepDataSoA>(m, "StepDataSoA")
-        .def(py::self == py::self)
+    py::class_<cvt::StepDataSoA> stepDataSoA(m, "StepDataSoA");
+    stepDataSoA.def(py::self == py::self)
         .def(py::self != py::self)
         .def_readwrite("gameStep", &cvt::StepDataSoA::gameStep)
         .def_readwrite("minerals", &cvt::StepDataSoA::minearals)
@@ -499,6 +651,12 @@ PYBIND11_MODULE(_sc2_serializer, m)
             if (i >= t.size()) { throw py::index_error(); }
             return t[i];
         });
+    defColumnView(stepDataSoA, "gameStep", &cvt::StepDataSoA::gameStep);
+    defColumnView(stepDataSoA, "minerals", &cvt::StepDataSoA::minearals);
+    defColumnView(stepDataSoA, "vespene", &cvt::StepDataSoA::vespene);
+    defColumnView(stepDataSoA, "popMax", &cvt::StepDataSoA::popMax);
+    defColumnView(stepDataSoA, "popArmy", &cvt::StepDataSoA::popArmy);
+    defColumnView(stepDataSoA, "popWorkers", &cvt::StepDataSoA::popWorkers);
 
     py::class_<cvt::ReplayInfo>(m, "ReplayInfo")
         .def(py::self == py::self)
@@ -530,6 +688,18 @@ PYBIND11_MODULE(_sc2_serializer, m)
                 info.mapHeight);
         });
 
+    py::class_<cvt::SharedReplayCache, std::shared_ptr<cvt::SharedReplayCache>>(m, "SharedReplayCache")
+        .def(py::init<const std::string &, std::size_t>(),
+            py::arg("name"),
+            py::arg("capacity_bytes") = 512 * 1024 * 1024,
+            py::call_guard<py::gil_scoped_release>())
+        .def("find", &cvt::SharedReplayCache::find, py::arg("dbPath"), py::arg("index"), py::call_guard<py::gil_scoped_release>())
+        .def("size", &cvt::SharedReplayCache::size)
+        .def("__len__", &cvt::SharedReplayCache::size)
+        .def("freeBytes", &cvt::SharedReplayCache::freeBytes)
+        .def_property_readonly("name", &cvt::SharedReplayCache::name)
+        .def_static("remove", &cvt::SharedReplayCache::remove, py::arg("name"));
+
     bindReplayDataInterfaces<cvt::ReplayDataSoANoUnitsMiniMap>(m, "ReplayDataScalarOnly");
 
     bindReplayDataInterfaces<cvt::ReplayDataSoANoUnits>(m, "ReplayDataNoUnits");
@@ -537,4 +707,18 @@ PYBIND11_MODULE(_sc2_serializer, m)
     bindReplayDataInterfaces<cvt::ReplayDataSoA>(m, "ReplayDataAll");
 
     m.def("set_replay_database_logger_level", &cvt::setReplayDBLoggingLevel, py::arg("lvl"));
+
+    m.def("get_perf_stats", []() {
+        py::dict stats;
+        for (std::size_t idx = 0; idx < cvt::perf::gStageNames.size(); ++idx) {
+            const auto [calls, nanos, bytes] = cvt::perf::Registry::get().read(static_cast<cvt::perf::Stage>(idx));
+            py::dict stage;
+            stage["calls"] = calls;
+            stage["nanos"] = nanos;
+            stage["bytes"] = bytes;
+            stats[cvt::perf::gStageNames[idx]] = stage;
+        }
+        return stats;
+    });
+    m.def("reset_perf_stats", []() { cvt::perf::Registry::get().reset(); });
 }
@@ -12,6 +12,7 @@
 #include "observer.hpp"
 #include "data_structures/replay_all.hpp"
 #include "observer_utils.hpp"
+#include "perf_stats.hpp"
 #include "serialize.hpp"
 
 namespace cvt {
@@ -23,6 +24,7 @@ template<> void BaseConverter<ReplayDataSoA>::clear() noexcept
     replayData_.data.clear();
     replayData_.header.heightMap.clear();
     resourceObs_.clear();
+    resourcePosIndex_.clear();
 
     mapDynHasLogged_ = false;
     mapHeightHasLogged_ = false;
@@ -64,9 +66,11 @@ template<> void BaseConverter<ReplayDataSoA>::OnGameEnd()
         std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::high_resolution_clock::now() - start_);
     SPDLOG_INFO("Replay ended, conversion duration: {:.1f}s", duration.count());
 
-    // Transform AoS to SoA and Write to database
-    writeSuccess_ = database_.addEntry(AoStoSoA<ReplayDataSoA, ReplayData>(replayData_));
-    SPDLOG_INFO("Saved Replay: {}, PlayerID: {}", replayData_.getReplayHash(), replayData_.getPlayerId());
+    // Hand the completed replay to the background writer which performs the SoA
+    // conversion, compression and disk write so the next replay can start immediately
+    SPDLOG_INFO("Queued Replay for Writing: {}, PlayerID: {}", replayData_.getReplayHash(), replayData_.getPlayerId());
+    this->enqueueWrite(std::move(replayData_));
+    writeSuccess_ = true;
 }
 
 template<> void BaseConverter<ReplayDataSoA>::copyHeightMapData() noexcept
@@ -155,9 +159,10 @@ template<> void BaseConverter<ReplayDataSoA>::copyCommonData() noexcept
 template<> void FullConverter<ReplayDataSoA>::OnStep()
 {
     gTimer.step(fmt::format("Step {} of {}", this->Observation()->GetGameLoop(), replayData_.header.durationSteps));
+    perf::ScopedTimer perfTimer(perf::Stage::StepCopy);
 
-    // "Initialize" next item
-    replayData_.data.resize(replayData_.data.size() + 1);
+    // "Initialize" next item, reusing pooled buffers from previously written replays
+    this->advanceStep();
 
     this->copyCommonData();
     this->copyUnitData();
@@ -168,14 +173,15 @@ template<> void FullConverter<ReplayDataSoA>::OnStep()
 template<> void ActionConverter<ReplayDataSoA>::OnStep()
 {
     gTimer.step(fmt::format("Step {} of {}", this->Observation()->GetGameLoop(), replayData_.header.durationSteps));
+    perf::ScopedTimer perfTimer(perf::Stage::StepCopy);
 
     // Need to have at least one buffer
-    if (replayData_.data.empty()) { replayData_.data.resize(1); }
+    if (replayData_.data.empty()) { this->advanceStep(); }
 
     if (!this->Observation()->GetRawActions().empty()) {
         this->copyActionData();
         // Previous observation locked in, current will write to new "space"
-        replayData_.data.resize(replayData_.data.size() + 1);
+        this->advanceStep();
     }
 
     // Always copy observation, the next step might have an action
@@ -193,9 +199,10 @@ template<> void StridedConverter<ReplayDataSoA>::OnStep()
     bool shouldRecord = gameStep % stride_ == 0;
     shouldRecord |= !this->Observation()->GetRawActions().empty() && saveActions_;
     if (!shouldRecord) { return; }
+    perf::ScopedTimer perfTimer(perf::Stage::StepCopy);
 
-    // "Initialize" next item
-    replayData_.data.resize(replayData_.data.size() + 1);
+    // "Initialize" next item, reusing pooled buffers from previously written replays
+    this->advanceStep();
 
     // Write directly into stepData.back()
     this->copyCommonData();
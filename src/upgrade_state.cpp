@@ -29,18 +29,31 @@
 
 namespace cvt {
 
-UpgradeState::UpgradeState(std::filesystem::path dataFile) : dataFile_(std::move(dataFile)) { this->loadInfo(); }
+UpgradeState::UpgradeState(std::filesystem::path dataFile) : dataFile_(std::move(dataFile)) {}
 
 void UpgradeState::setVersion(std::string_view version)
 {
-    if (!gameVersion2id2delay_.contains(std::string(version))) {
-        throw std::out_of_range(fmt::format("Game Version not found: {}", version));
+    const std::string versionKey(version);
+    if (!upgradeDelays.contains(versionKey) && !gameVersion2id2delay_.contains(versionKey)) {
+        // Fall back to the yaml data for game versions newer than the compiled-in table
+        this->loadInfo();
+        if (!gameVersion2id2delay_.contains(versionKey)) {
+            throw std::out_of_range(fmt::format("Game Version not found: {}", version));
+        }
     }
     gameVersion_ = version;
 }
 
 void UpgradeState::setRace(Race race) noexcept { currentRace_ = race; }
 
+auto UpgradeState::getDelayTable() const -> const std::unordered_map<int, int> &
+{
+    if (const auto compiled = upgradeDelays.find(gameVersion_); compiled != upgradeDelays.end()) {
+        return compiled->second;
+    }
+    return gameVersion2id2delay_.at(gameVersion_);
+}
+
 void UpgradeState::loadInfo()
 {
     if (!std::filesystem::exists(dataFile_)) {
@@ -78,7 +91,7 @@ auto UpgradeState::getValidRemap() const -> const std::unordered_map<int, std::a
 void UpgradeState::calculateTimes(const std::vector<std::vector<Action>> &playerActions,
     const std::vector<unsigned int> &gameTime)
 {
-    auto &id2delay = gameVersion2id2delay_.at(gameVersion_);
+    const auto &id2delay = this->getDelayTable();
     if (id2delay.empty()) { throw std::logic_error{ "Research info to delay not loaded" }; }
     if (currentRace_ == Race::Random) { throw std::logic_error{ "No race selected" }; }
     if (playerActions.size() != gameTime.size()) {
@@ -11,6 +11,7 @@
 
 #include "data_structures/replay_all.hpp"
 #include "database.hpp"
+#include "replay_cache.hpp"
 
 #include <boost/iostreams/device/file.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
@@ -20,6 +21,7 @@
 #include <absl/strings/str_format.h>
 #include <gtest/gtest.h>
 #include <numeric>
+#include <random>
 
 namespace fs = std::filesystem;
 
@@ -131,7 +133,12 @@ class DatabaseTest : public testing::Test
         replayDb_.addEntry(createReplay(123));
     }
 
-    void TearDown() override { fs::remove(dbPath_); }
+    void TearDown() override
+    {
+        fs::remove(dbPath_);
+        fs::remove(replayDb_.uidCachePath());
+        fs::remove(replayDb_.headerCachePath());
+    }
 
     // Defaults
     fs::path dbPath_ = "testdb.sc2db";
@@ -218,6 +225,241 @@ TEST_F(DatabaseTest, ReadDB)
     ASSERT_NE(replayDb_.getEntry(1), createReplay(120));
 }
 
+TEST_F(DatabaseTest, ReadAfterAppend)
+{
+    // The memory-mapped read view must be refreshed when the database grows
+    testReplayEquality(replayDb_.getEntry(0), createReplay(1));
+    replayDb_.addEntry(createReplay(42));
+    ASSERT_EQ(replayDb_.size(), 3);
+    testReplayEquality(replayDb_.getEntry(2), createReplay(42));
+}
+
+TEST_F(DatabaseTest, MixedCodecs)
+{
+    // Codec is inferred per-entry on read, so zlib and zstd entries can coexist in one database
+    replayDb_.setWriteCodec(cvt::Codec::Zstd);
+    replayDb_.addEntry(createReplay(7));
+    ASSERT_EQ(replayDb_.size(), 3);
+    testReplayEquality(replayDb_.getEntry(0), createReplay(1));
+    testReplayEquality(replayDb_.getEntry(2), createReplay(7));
+}
+
+TEST_F(DatabaseTest, ColumnSelection)
+{
+    // Selected columns must match a full read, unselected columns are left empty
+    const auto reference = replayDb_.getEntry(0);
+    const auto partial = replayDb_.getEntryColumns(0, { "gameStep", "visibility", "units" });
+    ASSERT_EQ(partial.header, reference.header);
+    ASSERT_EQ(partial.data.gameStep, reference.data.gameStep);
+    ASSERT_EQ(partial.data.visibility, reference.data.visibility);
+    ASSERT_EQ(partial.data.units, reference.data.units);
+    ASSERT_TRUE(partial.data.creep.empty());
+    ASSERT_TRUE(partial.data.minearals.empty());
+    ASSERT_TRUE(partial.data.neutralUnits.empty());
+
+    // An empty selection loads everything, unknown column names throw
+    testReplayEquality(replayDb_.getEntryColumns(1, {}), createReplay(123));
+    EXPECT_THROW(static_cast<void>(replayDb_.getEntryColumns(0, { "doesNotExist" })), std::out_of_range);
+}
+
+TEST_F(DatabaseTest, SharedCache)
+{
+    // Cached reads must match direct reads, and a second database handle attaching to the same segment sees hits
+    const std::string cacheName = "sc2_serializer_test_cache";
+    cvt::SharedReplayCache::remove(cacheName);
+    {
+        auto cache = std::make_shared<cvt::SharedReplayCache>(cacheName, 32 * 1024 * 1024);
+        replayDb_.attachCache(cache);
+        ASSERT_FALSE(cache->find(replayDb_.path(), 0).has_value());
+        testReplayEquality(replayDb_.getEntry(0), createReplay(1));// Miss, populates the cache
+        ASSERT_TRUE(cache->find(replayDb_.path(), 0).has_value());
+        testReplayEquality(replayDb_.getEntry(0), createReplay(1));// Hit, served from the cache
+        ASSERT_EQ(cache->size(), 1);
+
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> otherDb(dbPath_);
+        otherDb.attachCache(std::make_shared<cvt::SharedReplayCache>(cacheName));
+        testReplayEquality(otherDb.getEntry(0), createReplay(1));
+        ASSERT_EQ(cache->size(), 1);
+    }
+    ASSERT_TRUE(cvt::SharedReplayCache::remove(cacheName));
+}
+
+TEST_F(DatabaseTest, RawEntryCopy)
+{
+    // Raw-copied entries must decode identically in the target database without a recompression cycle
+    const fs::path mergePath = "testdb_merge.sc2db";
+    if (fs::exists(mergePath)) { fs::remove(mergePath); }
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> mergeDb(mergePath);
+        ASSERT_TRUE(mergeDb.addEntryRaw(replayDb_.getEntryRaw(0)));
+        ASSERT_TRUE(mergeDb.addEntryRaw(replayDb_.getEntryRaw(1)));
+        ASSERT_EQ(mergeDb.size(), 2);
+        testReplayEquality(mergeDb.getEntry(0), createReplay(1));
+        testReplayEquality(mergeDb.getEntry(1), createReplay(123));
+        ASSERT_EQ(mergeDb.getEntryUID(0), replayDb_.getEntryUID(0));
+        fs::remove(mergeDb.uidCachePath());
+        fs::remove(mergeDb.headerCachePath());
+    }
+    fs::remove(mergePath);
+}
+
+auto createMinimapReplay(unsigned int seed, std::size_t nSteps) -> cvt::ReplayDataSoA
+{
+    cvt::ReplayData replay;
+    replay.header.replayHash = "DeltaMinimap";
+    replay.data.resize(nSteps);
+
+    std::minstd_rand gen(seed);
+    cvt::Image<std::uint8_t> visibility;
+    visibility.resize(16, 16);
+    cvt::Image<bool> creep;
+    creep.resize(16, 16);
+    std::ranges::generate(visibility._data, [&] { return static_cast<std::byte>(gen()); });
+    std::ranges::generate(creep._data, [&] { return static_cast<std::byte>(gen()); });
+    for (std::size_t idx = 0; idx < nSteps; ++idx) {
+        // Flip a couple of bytes per step like a creeping visibility front
+        visibility._data[gen() % visibility._data.size()] = static_cast<std::byte>(gen());
+        creep._data[gen() % creep._data.size()] ^= static_cast<std::byte>(1U << gen() % 8);
+        auto &step = replay.data[idx];
+        step.gameStep = static_cast<std::uint32_t>(idx);
+        step.minearals = static_cast<std::uint16_t>(idx * 5);
+        step.visibility = visibility;
+        step.player_relative = visibility;
+        step.alerts = visibility;
+        step.creep = creep;
+        step.buildable = creep;
+        step.pathable = creep;
+        step.units.emplace_back(cvt::Unit{ .id = static_cast<cvt::UID>(idx % 7), .unitType = 2, .health = 1.f * idx });
+    }
+    return cvt::AoStoSoA<cvt::ReplayDataSoA, cvt::ReplayData>(replay);
+}
+
+TEST_F(DatabaseTest, DeltaMinimapRoundtrip)
+{
+    // Slowly changing minimap layers span several keyframe intervals and must reconstruct exactly
+    const auto expected = createMinimapReplay(77, 80);
+    ASSERT_TRUE(replayDb_.addEntry(expected));
+    ASSERT_EQ(replayDb_.getEntry(2), expected);
+}
+
+TEST_F(DatabaseTest, WindowedRead)
+{
+    // A windowed read must match the corresponding slice of the full entry, crossing a keyframe boundary
+    const auto expected = createMinimapReplay(99, 80);
+    ASSERT_TRUE(replayDb_.addEntry(expected));
+
+    const std::size_t start = 28;
+    const std::size_t count = 10;
+    const auto window = replayDb_.getEntryRange(2, start, count);
+    ASSERT_EQ(window.header, expected.header);
+    ASSERT_EQ(window.data.size(), count);
+    for (std::size_t idx = 0; idx < count; ++idx) { ASSERT_EQ(window.data[idx], expected.data[start + idx]); }
+
+    // A window reaching past the end of the replay is truncated
+    const auto tail = replayDb_.getEntryRange(2, 75, 10);
+    ASSERT_EQ(tail.data.size(), 5);
+    ASSERT_EQ(tail.data[0], expected.data[75]);
+}
+
+TEST_F(DatabaseTest, BatchedAppend)
+{
+    // Buffered entries are invisible until the batch fills or flush() is called, then decode normally
+    replayDb_.setBatchSize(3);
+    replayDb_.addEntry(createReplay(7));
+    replayDb_.addEntry(createReplay(42));
+    ASSERT_EQ(replayDb_.size(), 2);
+    ASSERT_TRUE(replayDb_.flush());
+    ASSERT_EQ(replayDb_.size(), 4);
+    testReplayEquality(replayDb_.getEntry(2), createReplay(7));
+    testReplayEquality(replayDb_.getEntry(3), createReplay(42));
+
+    // The third entry of a full batch lands together with the first two
+    replayDb_.addEntry(createReplay(8));
+    replayDb_.addEntry(createReplay(9));
+    ASSERT_EQ(replayDb_.size(), 4);
+    replayDb_.addEntry(createReplay(10));
+    ASSERT_EQ(replayDb_.size(), 7);
+    testReplayEquality(replayDb_.getEntry(6), createReplay(10));
+
+    // A reloaded handle sees everything that was committed
+    cvt::ReplayDatabase<cvt::ReplayDataSoA> loadDb(dbPath_);
+    ASSERT_EQ(loadDb.size(), 7);
+    testReplayEquality(loadDb.getEntry(4), createReplay(8));
+}
+
+TEST_F(DatabaseTest, GrowableIndex)
+{
+    // A fresh database starts with the v2 header and a single index block rather than the old 8MB zero LUT
+    const fs::path growPath = "testdb_grow.sc2db";
+    if (fs::exists(growPath)) { fs::remove(growPath); }
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> growDb(growPath);
+        ASSERT_LT(fs::file_size(growPath), 16 * 1024);
+        ASSERT_FALSE(growDb.isFull());
+
+        growDb.addEntry(createReplay(1));
+        growDb.addEntry(createReplay(123));
+        fs::remove(growDb.uidCachePath());
+        fs::remove(growDb.headerCachePath());
+    }
+    {
+        // Reload walks the index chain, and appending after reload stays consistent
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> growDb(growPath);
+        ASSERT_EQ(growDb.size(), 2);
+        testReplayEquality(growDb.getEntry(1), createReplay(123));
+        growDb.addEntry(createReplay(42));
+        fs::remove(growDb.uidCachePath());
+        fs::remove(growDb.headerCachePath());
+    }
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> growDb(growPath);
+        ASSERT_EQ(growDb.size(), 3);
+        testReplayEquality(growDb.getEntry(0), createReplay(1));
+        testReplayEquality(growDb.getEntry(2), createReplay(42));
+    }
+    fs::remove(growPath);
+}
+
+TEST_F(DatabaseTest, BatchedRead)
+{
+    const std::vector<std::size_t> indices{ 1, 0, 1 };
+    const auto entries = replayDb_.getEntries(indices);
+    ASSERT_EQ(entries.size(), indices.size());
+    testReplayEquality(entries[0], createReplay(123));
+    testReplayEquality(entries[1], createReplay(1));
+    testReplayEquality(entries[2], createReplay(123));
+    EXPECT_THROW(static_cast<void>(replayDb_.getEntries(std::vector<std::size_t>{ 0, 99 })), std::out_of_range);
+}
+
+TEST_F(DatabaseTest, HeaderSidecarIndex)
+{
+    ASSERT_TRUE(fs::exists(replayDb_.headerCachePath()));
+    const auto headers = replayDb_.getAllHeaders();
+    ASSERT_EQ(headers.size(), replayDb_.size());
+    ASSERT_EQ(headers[0], createReplay(1).header);
+    ASSERT_EQ(headers[1], createReplay(123).header);
+
+    // Legacy database without a sidecar rebuilds the index on demand
+    fs::remove(replayDb_.headerCachePath());
+    cvt::ReplayDatabase<cvt::ReplayDataSoA> loadDB(dbPath_);
+    ASSERT_EQ(loadDB.getAllHeaders(), headers);
+    ASSERT_TRUE(fs::exists(loadDB.headerCachePath()));
+}
+
+TEST_F(DatabaseTest, UIDSidecarIndex)
+{
+    // Sidecar is written incrementally by addEntry
+    ASSERT_TRUE(fs::exists(replayDb_.uidCachePath()));
+    const auto expectedUIDs = std::unordered_set<std::string>{ replayDb_.getEntryUID(0), replayDb_.getEntryUID(1) };
+    ASSERT_EQ(replayDb_.getAllUIDs(), expectedUIDs);
+
+    // Legacy database without a sidecar rebuilds (and persists) the index on demand
+    fs::remove(replayDb_.uidCachePath());
+    cvt::ReplayDatabase<cvt::ReplayDataSoA> loadDB(dbPath_);
+    ASSERT_EQ(loadDB.getAllUIDs(), expectedUIDs);
+    ASSERT_TRUE(fs::exists(loadDB.uidCachePath()));
+}
+
 TEST_F(DatabaseTest, LoadDB)
 {
     cvt::ReplayDatabase<cvt::ReplayDataSoA> loadDB(dbPath_);
@@ -225,6 +467,46 @@ TEST_F(DatabaseTest, LoadDB)
     for (std::size_t i = 0; i < replayDb_.size(); ++i) { ASSERT_EQ(replayDb_.getEntry(i), loadDB.getEntry(i)); }
 }
 
+TEST_F(DatabaseTest, ShardedView)
+{
+    const fs::path shardDir = "testdb_shards";
+    fs::remove_all(shardDir);
+    fs::create_directory(shardDir);
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> shardA(shardDir / "a.SC2Replays");
+        shardA.addEntry(createReplay(1));
+        shardA.addEntry(createReplay(123));
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> shardB(shardDir / "b.SC2Replays");
+        shardB.addEntry(createReplay(42));
+    }
+
+    cvt::ShardedReplayDatabase<cvt::ReplayDataSoA> sharded(shardDir);
+    ASSERT_EQ(sharded.numShards(), 2);
+    ASSERT_EQ(sharded.size(), 3);
+    // Flat indices span the shard boundary in filename order
+    testReplayEquality(sharded.getEntry(0), createReplay(1));
+    testReplayEquality(sharded.getEntry(1), createReplay(123));
+    testReplayEquality(sharded.getEntry(2), createReplay(42));
+    ASSERT_EQ(sharded.getHeader(2), createReplay(42).header);
+    ASSERT_THROW(static_cast<void>(sharded.getEntry(3)), std::out_of_range);
+
+    // The global index is persisted and reused on reopen
+    ASSERT_TRUE(fs::exists(sharded.shardIndexPath()));
+    cvt::ShardedReplayDatabase<cvt::ReplayDataSoA> reopened(shardDir);
+    ASSERT_EQ(reopened.size(), 3);
+    testReplayEquality(reopened.getEntry(2), createReplay(42));
+
+    // Appending to a shard invalidates the persisted index which is then rebuilt
+    {
+        cvt::ReplayDatabase<cvt::ReplayDataSoA> shardB(shardDir / "b.SC2Replays");
+        shardB.addEntry(createReplay(7));
+    }
+    cvt::ShardedReplayDatabase<cvt::ReplayDataSoA> grown(shardDir);
+    ASSERT_EQ(grown.size(), 4);
+    testReplayEquality(grown.getEntry(3), createReplay(7));
+    fs::remove_all(shardDir);
+}
+
 namespace cvt {
 
 template<typename Sink> void AbslStringify(Sink &sink, Unit unit) { absl::Format(&sink, "%s", std::string(unit)); }
@@ -261,6 +543,74 @@ TEST(UnitSoA, ConversionToAndFrom)
     }
 }
 
+TEST(UnitSoA, ConversionToAndFromPar)
+{
+    const auto replayData = createReplay(13);
+    auto unitKey = [](const auto &unit) { return unit.id; };
+    {
+        const auto flattened = cvt::flattenAndSortDataPar<cvt::UnitSoA>(replayData.data.units, unitKey);
+        const auto expected = cvt::flattenAndSortData2<cvt::UnitSoA>(replayData.data.units, sortByUnitId<cvt::Unit>);
+        ASSERT_EQ(flattened.data, expected.data);
+        const auto recovered = cvt::recoverFlattenedSortedData2<cvt::UnitSoA>(flattened);
+        UnitSetEqualityVec(replayData.data.units, recovered);
+    }
+    {
+        const auto flattened = cvt::flattenAndSortDataPar<cvt::NeutralUnitSoA>(replayData.data.neutralUnits, unitKey);
+        const auto recovered = cvt::recoverFlattenedSortedData2<cvt::NeutralUnitSoA>(flattened);
+        UnitSetEqualityVec(replayData.data.neutralUnits, recovered);
+    }
+}
+
+TEST(UnitSoA, RecoverPar)
+{
+    const auto replayData = createReplay(17);
+    {
+        const auto flattened = cvt::flattenAndSortData2<cvt::UnitSoA>(replayData.data.units, sortByUnitId<cvt::Unit>);
+        const auto recovered = cvt::recoverFlattenedSortedData2Par<cvt::UnitSoA>(flattened);
+        ASSERT_EQ(recovered, cvt::recoverFlattenedSortedData2<cvt::UnitSoA>(flattened));
+        UnitSetEqualityVec(replayData.data.units, recovered);
+    }
+    {
+        const auto flattened =
+            cvt::flattenAndSortData2<cvt::NeutralUnitSoA>(replayData.data.neutralUnits, sortByUnitId<cvt::NeutralUnit>);
+        const auto recovered = cvt::recoverFlattenedSortedData2Par<cvt::NeutralUnitSoA>(flattened);
+        ASSERT_EQ(recovered, cvt::recoverFlattenedSortedData2<cvt::NeutralUnitSoA>(flattened));
+        UnitSetEqualityVec(replayData.data.neutralUnits, recovered);
+    }
+}
+
+TEST(ActionSoA, ConversionToAndFrom)
+{
+    const auto replayData = createReplay(7);
+    const auto flattened = cvt::flattenActions(replayData.data.actions);
+    ASSERT_EQ(flattened.numSteps(), replayData.data.actions.size());
+    ASSERT_EQ(flattened.size(), std::size_t(12));
+    ASSERT_EQ(flattened.unit_offsets.size(), flattened.size() + 1);
+    ASSERT_EQ(replayData.data.actions[0][0], flattened[0]);
+    ASSERT_EQ(replayData.data.actions, cvt::recoverActions(flattened));
+}
+
+TEST(ActionSoA, WindowedRecovery)
+{
+    // Three steps with a distinguishable action count each, recover the middle step only
+    std::vector<std::vector<cvt::Action>> stepActions(3);
+    for (std::size_t step = 0; step < stepActions.size(); ++step) {
+        for (std::size_t i = 0; i <= step; ++i) {
+            cvt::Action action = { .unit_ids = { static_cast<cvt::UID>(step), static_cast<cvt::UID>(i) },
+                .ability_id = static_cast<int>(step * 10 + i),
+                .target_type = cvt::Action::TargetType::Position,
+                .target = cvt::Action::Target(cvt::Point2d(static_cast<int>(i), 2)) };
+            stepActions[step].emplace_back(std::move(action));
+        }
+    }
+    const auto flattened = cvt::flattenActions(stepActions);
+    const auto window = cvt::recoverActionsWindow(flattened, 1, 1);
+    ASSERT_EQ(window.size(), std::size_t(1));
+    ASSERT_EQ(window.front(), stepActions[1]);
+    // Out-of-range windows clamp rather than throw
+    ASSERT_TRUE(cvt::recoverActionsWindow(flattened, 5, 2).empty());
+}
+
 TEST(UnitSoA, ConversionToAndFrom2)
 {
     auto dbPath = std::getenv("SC2_TEST_DB");
@@ -17,8 +17,10 @@
 
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <numeric>
 #include <ranges>
+#include <sstream>
 
 class ReplayDataTest : public testing::Test
 {
@@ -204,3 +206,53 @@ TEST_F(ReplayDataTest, ReadWriteReplay)
     // Ensure equal after reading
     ASSERT_EQ(readReplay, writeReplay);
 }
+
+TEST_F(ReplayDataTest, DeltaVarintRoundTrip)
+{
+    // Monotonic, repetitive, signed and empty columns must all round-trip exactly
+    std::vector<std::uint64_t> monotonic(1000);
+    std::iota(monotonic.begin(), monotonic.end(), std::uint64_t(42));
+    std::vector<std::uint32_t> repetitive = { 7, 7, 7, 8, 8, 1000000, 1000000 };
+    std::vector<std::int32_t> wobbly = { -5, -4, 100, -1000000, std::numeric_limits<std::int32_t>::max() };
+    std::vector<std::uint32_t> empty{};
+
+    auto roundTrip = [](const auto &writeData) {
+        std::stringstream stream;
+        cvt::serializeDeltaVarint(writeData, stream);
+        std::remove_cvref_t<decltype(writeData)> readData;
+        cvt::deserializeDeltaVarint(readData, stream);
+        ASSERT_EQ(writeData, readData);
+    };
+    roundTrip(monotonic);
+    roundTrip(repetitive);
+    roundTrip(wobbly);
+    roundTrip(empty);
+
+    // Monotonic unit-stride columns should shrink to roughly a byte per element
+    std::stringstream stream;
+    cvt::serializeDeltaVarint(monotonic, stream);
+    ASSERT_LT(stream.str().size(), monotonic.size() * 2);
+}
+
+TEST_F(ReplayDataTest, BlockBufferedWrite)
+{
+    // Serializing through a BlockBuffer must produce byte-identical output to writing directly
+    {
+        std::ofstream out_stream(testFilename_, std::ios::binary);
+        cvt::serialize(replay_, out_stream);
+    }
+
+    cvt::BlockBuffer block{};
+    {
+        std::ostream blockStream(&block);
+        cvt::serialize(replay_, blockStream);
+    }
+
+    std::ifstream in_stream(testFilename_, std::ios::binary);
+    std::vector<char> direct(std::istreambuf_iterator<char>(in_stream), {});
+    ASSERT_EQ(block.size(), direct.size());
+
+    std::stringstream buffered;
+    block.writeTo(buffered);
+    ASSERT_EQ(buffered.str(), std::string(direct.begin(), direct.end()));
+}
@@ -71,3 +71,28 @@ TEST(SoATransforms, DiffOrder)
     auto aos1 = cvt::SoAtoAoS(soa);
     ASSERT_EQ(aos1, aos);
 }
+
+TEST(SoASlicing, ColumnSpans)
+{
+    std::vector<A> aos{ { 1, 2, 3 }, { 3, 4, 4 }, { 5, 6, 8 }, { 7, 8, 2 } };
+    auto soa = cvt::AoStoSoA<ASoA>(aos);
+
+    // Name lookup resolves the column index regardless of declaration order
+    static_assert(cvt::getColumnIndex<ASoA>("b") == 1);
+    static_assert(cvt::getColumnIndex<ASoA2>("b") == 0);
+
+    // Span references the column storage directly over the requested window
+    auto bSlice = cvt::sliceColumn<cvt::getColumnIndex<ASoA>("b")>(soa, 1, 3);
+    ASSERT_EQ(bSlice.size(), 2);
+    ASSERT_EQ(bSlice.data(), soa.b.data() + 1);
+    for (auto idx : std::ranges::iota_view{ std::size_t(0), bSlice.size() }) { ASSERT_EQ(bSlice[idx], soa.b[idx + 1]); }
+
+    // Out-of-range requests are clamped rather than UB
+    ASSERT_EQ(cvt::sliceColumn<0>(soa, 2, 100).size(), 2);
+    ASSERT_TRUE(cvt::sliceColumn<0>(soa, 100, 200).empty());
+
+    auto [aSlice, cSlice] =
+        cvt::sliceColumns<cvt::getColumnIndex<ASoA>("a"), cvt::getColumnIndex<ASoA>("c")>(soa, 0, soa.size());
+    ASSERT_EQ(aSlice.size(), soa.size());
+    ASSERT_EQ(cSlice.back(), soa.c.back());
+}
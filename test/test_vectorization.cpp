@@ -3,6 +3,9 @@
 
 #include <gtest/gtest.h>
 
+#include <bit>
+#include <bitset>
+
 TEST(AutoVectorTest, OneHotEnum)
 {
     ASSERT_EQ(cvt::numEnumValues<cvt::Alliance>(), std::size_t(4));
@@ -97,3 +100,55 @@ TEST(AutoVectorTest, Unit)
         ASSERT_EQ(unit.is_flying, vec[27 + addOff]);
     }
 }
+
+TEST(AutoVectorTest, CompileTimePlan)
+{
+    cvt::Unit unit;
+    unit.id = 4321;
+    unit.observation = cvt::Visibility::Hidden;
+    unit.alliance = cvt::Alliance::Enemy;
+    unit.cloak_state = cvt::CloakState::Cloaked;
+    unit.pos = { 4.5f, 6.7f, 8.9f };
+    unit.health = 67;
+
+    // The compile-time onehot plan must produce the same output as the runtime-dispatched overload
+    std::vector<float> oneHotVec(cvt::getVectorizedSize<cvt::Unit>(true));
+    cvt::vectorize<true>(unit, oneHotVec.begin());
+    ASSERT_EQ(oneHotVec, cvt::vectorize<float>(unit, true));
+
+    std::vector<float> plainVec(cvt::getVectorizedSize<cvt::Unit>(false));
+    cvt::vectorize<false>(unit, plainVec.begin());
+    ASSERT_EQ(plainVec, cvt::vectorize<float>(unit, false));
+}
+
+TEST(AutoVectorTest, ScoreBlockCopy)
+{
+    // Score is all-float with no padding so it qualifies for the memcpy fast path, mismatched element types and
+    // mixed-field structs do not
+    static_assert(cvt::detail::isBlockCopyable<cvt::Score, float>());
+    static_assert(!cvt::detail::isBlockCopyable<cvt::Score, double>());
+    static_assert(!cvt::detail::isBlockCopyable<cvt::Unit, float>());
+
+    cvt::Score score{};
+    score.score_float = 123.f;
+    score.collected_minerals = 45.f;
+    score.total_healed_energy = 9.f;
+    std::vector<float> vec(cvt::getVectorizedSize<cvt::Score>(false));
+    cvt::vectorize<false>(score, vec.begin());
+    ASSERT_EQ(vec.front(), score.score_float);
+    ASSERT_EQ(vec.back(), score.total_healed_energy);
+    ASSERT_EQ(vec, cvt::vectorize<float>(score, false));
+}
+
+TEST(BitUnpackTest, SpreadBitsToBytes)
+{
+    // Every byte value must expand to eight 0/1 bytes, MSB first
+    for (std::size_t value = 0; value < 256; ++value) {
+        const auto spread = cvt::detail::spreadBitsToBytes(static_cast<std::uint8_t>(value));
+        const auto bytes = std::bit_cast<std::array<std::uint8_t, 8>>(spread);
+        const auto bits = std::bitset<8>(value);
+        for (std::size_t j = 0; j < 8; ++j) {
+            ASSERT_EQ(bytes[j], static_cast<std::uint8_t>(bits[7 - j])) << fmt::format("value {} bit {}", value, j);
+        }
+    }
+}